@@ -0,0 +1,496 @@
+#include "DynamicIndexListView.h"
+#include "IUserIndexDynamicListEntry.h"
+#include "Styling/UMGCoreStyle.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(DynamicIndexListView)
+
+#define LOCTEXT_NAMESPACE "UMG"
+
+/////////////////////////////////////////////////////
+// UDynamicIndexListView
+
+static FTableViewStyle* DefaultIndexListViewStyle = nullptr;
+static FScrollBarStyle* DefaultIndexListViewScrollBarStyle = nullptr;
+
+#if WITH_EDITOR
+static FTableViewStyle* EditorIndexListViewStyle = nullptr;
+static FScrollBarStyle* EditorIndexListViewScrollBarStyle = nullptr;
+#endif
+
+UDynamicIndexListView::UDynamicIndexListView(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Orientation(EOrientation::Orient_Vertical)
+{
+	if (DefaultIndexListViewStyle == nullptr)
+	{
+		DefaultIndexListViewStyle = new FTableViewStyle(FUMGCoreStyle::Get().GetWidgetStyle<FTableViewStyle>("ListView"));
+
+		// Unlink UMG default colors.
+		DefaultIndexListViewStyle->UnlinkColors();
+	}
+
+	if (DefaultIndexListViewScrollBarStyle == nullptr)
+	{
+		DefaultIndexListViewScrollBarStyle = new FScrollBarStyle(FUMGCoreStyle::Get().GetWidgetStyle<FScrollBarStyle>("Scrollbar"));
+
+		// Unlink UMG default colors.
+		DefaultIndexListViewScrollBarStyle->UnlinkColors();
+	}
+
+	WidgetStyle = *DefaultIndexListViewStyle;
+	ScrollBarStyle = *DefaultIndexListViewScrollBarStyle;
+
+#if WITH_EDITOR
+	if (EditorIndexListViewStyle == nullptr)
+	{
+		EditorIndexListViewStyle = new FTableViewStyle(FAppStyle::Get().GetWidgetStyle<FTableViewStyle>("ListView"));
+
+		// Unlink UMG default colors.
+		EditorIndexListViewStyle->UnlinkColors();
+	}
+
+	if (EditorIndexListViewScrollBarStyle == nullptr)
+	{
+		EditorIndexListViewScrollBarStyle = new FScrollBarStyle(FCoreStyle::Get().GetWidgetStyle<FScrollBarStyle>("Scrollbar"));
+
+		// Unlink UMG default colors.
+		EditorIndexListViewScrollBarStyle->UnlinkColors();
+	}
+
+	if (IsEditorWidget())
+	{
+		WidgetStyle = *EditorIndexListViewStyle;
+		ScrollBarStyle = *EditorIndexListViewScrollBarStyle;
+	}
+#endif // WITH_EDITOR
+}
+
+void UDynamicIndexListView::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyListView.Reset();
+}
+
+#if WITH_EDITOR
+void UDynamicIndexListView::OnRefreshDesignerItems()
+{
+	RefreshDesignerItems<FDynamicListItemHandle>(ListItems, [this] () { return MakeItemHandle(); });
+}
+#endif
+
+FDynamicListItemHandle UDynamicIndexListView::MakeItemHandle()
+{
+	// Skip the null handle when the identifiers wrap around, by then the rows using the first ones are long gone
+	if (++LastItemHandleId == 0)
+	{
+		++LastItemHandleId;
+	}
+	return FDynamicListItemHandle(LastItemHandleId);
+}
+
+void UDynamicIndexListView::SetNumItems(int32 NumItems)
+{
+	if (NumItems < 0)
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot set the number of items of ListView to %d."), NumItems), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems > ListItems.Num())
+	{
+		InsertItems(ListItems.Num(), NumItems - ListItems.Num());
+	}
+	else if (NumItems < ListItems.Num())
+	{
+		RemoveItems(NumItems, ListItems.Num() - NumItems);
+	}
+}
+
+int32 UDynamicIndexListView::GetNumItems() const
+{
+	return ListItems.Num();
+}
+
+void UDynamicIndexListView::InsertItems(int32 Index, int32 NumItems)
+{
+	if (Index < 0 || NumItems < 0 || Index > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot insert %d items into ListView at index %d, it only has %d items."), NumItems, Index, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems == 0)
+	{
+		return;
+	}
+
+	const FDynamicListItemHandle PreviousFirstItem = GetItemAt(0);
+	ListItems.InsertUninitialized(Index, NumItems);
+	for (int32 ItemIndex = Index; ItemIndex < Index + NumItems; ++ItemIndex)
+	{
+		ListItems[ItemIndex] = MakeItemHandle();
+	}
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsInserted(Index, NumItems);
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+}
+
+void UDynamicIndexListView::RemoveItems(int32 Index, int32 NumItems)
+{
+	if (Index < 0 || NumItems < 0 || Index + NumItems > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot remove %d items from ListView at index %d, it only has %d items."), NumItems, Index, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems == 0)
+	{
+		return;
+	}
+
+	// Handles are never reused, their lengths would stay in the length cache for good
+	if (MyListView.IsValid())
+	{
+		MyListView->ForgetItemLengths(Index, NumItems);
+	}
+
+	const FDynamicListItemHandle PreviousFirstItem = GetItemAt(0);
+	ListItems.RemoveAt(Index, NumItems);
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsRemoved(Index, NumItems);
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+}
+
+void UDynamicIndexListView::MoveItems(int32 FromIndex, int32 NumItems, int32 ToIndex)
+{
+	if (FromIndex < 0 || ToIndex < 0 || NumItems < 0 || FMath::Max(FromIndex, ToIndex) + NumItems > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot move %d items of ListView from index %d to index %d, it only has %d items."), NumItems, FromIndex, ToIndex, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems == 0 || FromIndex == ToIndex)
+	{
+		return;
+	}
+
+	const FDynamicListItemHandle PreviousFirstItem = GetItemAt(0);
+	const TArray<FDynamicListItemHandle> MovedItems(ListItems.GetData() + FromIndex, NumItems);
+	ListItems.RemoveAt(FromIndex, NumItems);
+	ListItems.Insert(MovedItems, ToIndex);
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsMoved(FromIndex, NumItems, ToIndex);
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+}
+
+void UDynamicIndexListView::RefreshItems(int32 Index, int32 NumItems)
+{
+	if (Index < 0 || NumItems < 0 || Index + NumItems > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot refresh %d items of ListView at index %d, it only has %d items."), NumItems, Index, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems == 0)
+	{
+		return;
+	}
+
+	// The rows keep their handles, so their entries and selection stay. Entries in view are told to read their data again.
+	if (MyListView.IsValid())
+	{
+		for (int32 ItemIndex = Index; ItemIndex < Index + NumItems; ++ItemIndex)
+		{
+			const TSharedPtr<ITableRow> RowWidget = MyListView->WidgetFromItem(ListItems[ItemIndex]);
+			if (RowWidget.IsValid())
+			{
+				StaticCastSharedPtr<SObjectDynamicTableRow<FDynamicListItemHandle>>(RowWidget)->InitializeObjectRow_DynamicInternal(ListItems[ItemIndex]);
+			}
+		}
+	}
+
+	InvalidateItemLengthRange(Index, NumItems);
+}
+
+void UDynamicIndexListView::ClearListItems()
+{
+	if (MyListView.IsValid())
+	{
+		MyListView->ForgetItemLengths(0, ListItems.Num());
+	}
+	ListItems.Reset();
+
+	RequestRefresh();
+}
+
+void UDynamicIndexListView::InvalidateFirstEntryLengths(FDynamicListItemHandle PreviousFirstItem)
+{
+	if (EntrySpacing == 0.f || ListItems.Num() == 0 || ListItems[0] == PreviousFirstItem)
+	{
+		return;
+	}
+
+	InvalidateItemLengthRange(0, 1);
+
+	const int32 PreviousFirstIndex = PreviousFirstItem.IsValid() ? GetIndexForItem(PreviousFirstItem) : INDEX_NONE;
+	if (PreviousFirstIndex != INDEX_NONE)
+	{
+		InvalidateItemLengthRange(PreviousFirstIndex, 1);
+	}
+}
+
+FDynamicListItemHandle UDynamicIndexListView::GetItemAt(int32 Index) const
+{
+	return ListItems.IsValidIndex(Index) ? ListItems[Index] : FDynamicListItemHandle();
+}
+
+int32 UDynamicIndexListView::GetIndexForItem(const FDynamicListItemHandle& Item) const
+{
+	// The list widget keeps an item to index map in sync with ListItems, only search them before it is constructed
+	if (MyListView.IsValid())
+	{
+		return MyListView->GetIndexOfItem(Item);
+	}
+	return ListItems.IndexOfByKey(Item);
+}
+
+int32 UDynamicIndexListView::GetIndexForEntryWidget(const UUserWidget* EntryWidget) const
+{
+	const FDynamicListItemHandle* ListItem = EntryWidget ? ItemFromEntryWidget(*EntryWidget) : nullptr;
+	return ListItem ? GetIndexForItem(*ListItem) : INDEX_NONE;
+}
+
+UUserWidget* UDynamicIndexListView::GetEntryWidgetFromIndex(int32 Index) const
+{
+	return ListItems.IsValidIndex(Index) ? GetEntryWidgetFromItem(ListItems[Index]) : nullptr;
+}
+
+void UDynamicIndexListView::SetSelectionMode(TEnumAsByte<ESelectionMode::Type> InSelectionMode)
+{
+	SelectionMode = InSelectionMode;
+	if (MyListView)
+	{
+		MyListView->SetSelectionMode(InSelectionMode);
+	}
+}
+
+void UDynamicIndexListView::SetSelectedIndex(int32 Index)
+{
+	if (ListItems.IsValidIndex(Index))
+	{
+		SetSelectedItem(ListItems[Index]);
+	}
+}
+
+void UDynamicIndexListView::SetIndexSelection(int32 Index, bool bSelected)
+{
+	if (ListItems.IsValidIndex(Index))
+	{
+		SetItemSelection(ListItems[Index], bSelected);
+	}
+}
+
+int32 UDynamicIndexListView::GetSelectedIndex() const
+{
+	const FDynamicListItemHandle SelectedItem = GetSelectedItem();
+	return SelectedItem.IsValid() ? GetIndexForItem(SelectedItem) : INDEX_NONE;
+}
+
+bool UDynamicIndexListView::GetSelectedIndices(TArray<int32>& Indices) const
+{
+	TArray<FDynamicListItemHandle> SelectedItems;
+	GetSelectedItems(SelectedItems);
+
+	Indices.Reset(SelectedItems.Num());
+	for (const FDynamicListItemHandle& SelectedItem : SelectedItems)
+	{
+		Indices.Add(GetIndexForItem(SelectedItem));
+	}
+	return Indices.Num() > 0;
+}
+
+bool UDynamicIndexListView::IsIndexSelected(int32 Index) const
+{
+	return ListItems.IsValidIndex(Index) && IsItemSelected(ListItems[Index]);
+}
+
+bool UDynamicIndexListView::IsIndexVisible(int32 Index) const
+{
+	return ListItems.IsValidIndex(Index) && IsItemVisible(ListItems[Index]);
+}
+
+bool UDynamicIndexListView::IsRefreshPending() const
+{
+	if (MyListView.IsValid())
+	{
+		return MyListView->IsPendingRefresh();
+	}
+	return false;
+}
+
+void UDynamicIndexListView::ScrollIndexIntoView(int32 Index)
+{
+	if (ListItems.IsValidIndex(Index))
+	{
+		RequestScrollItemIntoView(ListItems[Index]);
+	}
+}
+
+void UDynamicIndexListView::ScrollIndexIntoViewAligned(int32 Index, EDescendantScrollDestination Alignment, float Padding)
+{
+	if (ListItems.IsValidIndex(Index))
+	{
+		RequestScrollItemIntoView(ListItems[Index], Alignment, Padding);
+	}
+}
+
+void UDynamicIndexListView::NavigateToIndex(int32 Index)
+{
+	if (ListItems.IsValidIndex(Index))
+	{
+		RequestNavigateToItem(ListItems[Index]);
+	}
+}
+
+void UDynamicIndexListView::BP_ClearSelection()
+{
+	ClearSelection();
+}
+
+int32 UDynamicIndexListView::BP_GetNumItemsSelected() const
+{
+	return GetNumItemsSelected();
+}
+
+void UDynamicIndexListView::BP_InvalidateIndexLength(int32 Index)
+{
+	if (ListItems.IsValidIndex(Index))
+	{
+		InvalidateItemLength(ListItems[Index]);
+	}
+}
+
+void UDynamicIndexListView::BP_CancelScrollIntoView()
+{
+	if (MyListView.IsValid())
+	{
+		MyListView->CancelScrollIntoView();
+	}
+}
+
+bool UDynamicIndexListView::GetEntryLengthForIndex_Implementation(int32 Index, float& OutLength) const
+{
+	return false;
+}
+
+TOptional<float> UDynamicIndexListView::HandleGetItemLength(FDynamicListItemHandle Item) const
+{
+	float EntryLength = 0.f;
+	if (!GetEntryLengthForIndex(GetIndexForItem(Item), EntryLength))
+	{
+		return TOptional<float>();
+	}
+
+	// Add the spacing measured entries get through their padding
+	const FMargin EntryPadding = GetDesiredEntryPadding(Item);
+	return EntryLength + (Orientation == EOrientation::Orient_Horizontal ? EntryPadding.GetTotalSpaceAlong<Orient_Horizontal>() : EntryPadding.GetTotalSpaceAlong<Orient_Vertical>());
+}
+
+void UDynamicIndexListView::HandleOnEntryInitializedInternal(FDynamicListItemHandle Item, const TSharedRef<ITableRow>& TableRow)
+{
+	HandleEntryInitialized(Item, TableRow);
+	BP_OnEntryInitialized.Broadcast(GetIndexForItem(Item), GetEntryWidgetFromItem(Item));
+}
+
+TSharedRef<SDynamicTableViewBase> UDynamicIndexListView::RebuildListWidget()
+{
+	return ConstructListView<SDynamicListView>();
+}
+
+void UDynamicIndexListView::HandleListEntryHovered(UUserWidget& EntryWidget)
+{
+	if (const FDynamicListItemHandle* ListItem = ItemFromEntryWidget(EntryWidget))
+	{
+		OnItemIsHoveredChanged().Broadcast(*ListItem, true);
+		BP_OnItemIsHoveredChanged.Broadcast(GetIndexForItem(*ListItem), true);
+	}
+}
+
+void UDynamicIndexListView::HandleListEntryUnhovered(UUserWidget& EntryWidget)
+{
+	if (const FDynamicListItemHandle* ListItem = ItemFromEntryWidget(EntryWidget))
+	{
+		OnItemIsHoveredChanged().Broadcast(*ListItem, false);
+		BP_OnItemIsHoveredChanged.Broadcast(GetIndexForItem(*ListItem), false);
+	}
+}
+
+FMargin UDynamicIndexListView::GetDesiredEntryPadding(FDynamicListItemHandle Item) const
+{
+	if (ListItems.Num() > 0 && ListItems[0] != Item)
+	{
+		if (Orientation == EOrientation::Orient_Horizontal)
+		{
+			// For all entries after the first one, add the spacing as left padding
+			return FMargin(EntrySpacing, 0.f, 0.0f, 0.f);
+		}
+		else
+		{
+			// For all entries after the first one, add the spacing as top padding
+			return FMargin(0.f, EntrySpacing, 0.f, 0.f);
+		}
+	}
+
+	return FMargin(0.f);
+}
+
+UUserWidget& UDynamicIndexListView::OnGenerateEntryWidgetInternal(FDynamicListItemHandle Item, TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<SDynamicTableViewBase>& OwnerTable)
+{
+	return GenerateTypedEntry<UUserWidget, SObjectDynamicTableRow<FDynamicListItemHandle>>(DesiredEntryClass, OwnerTable);
+}
+
+void UDynamicIndexListView::OnItemClickedInternal(FDynamicListItemHandle ListItem)
+{
+	ITypedUMGDynamicListView::OnItemClickedInternal(ListItem);
+	BP_OnItemClicked.Broadcast(GetIndexForItem(ListItem));
+}
+
+void UDynamicIndexListView::OnItemDoubleClickedInternal(FDynamicListItemHandle ListItem)
+{
+	ITypedUMGDynamicListView::OnItemDoubleClickedInternal(ListItem);
+	BP_OnItemDoubleClicked.Broadcast(GetIndexForItem(ListItem));
+}
+
+void UDynamicIndexListView::OnSelectionChangedInternal(FDynamicListItemHandle FirstSelectedItem)
+{
+	ITypedUMGDynamicListView::OnSelectionChangedInternal(FirstSelectedItem);
+	BP_OnItemSelectionChanged.Broadcast(FirstSelectedItem.IsValid() ? GetIndexForItem(FirstSelectedItem) : INDEX_NONE, FirstSelectedItem.IsValid());
+}
+
+void UDynamicIndexListView::OnItemScrolledIntoViewInternal(FDynamicListItemHandle ListItem, UUserWidget& EntryWidget)
+{
+	ITypedUMGDynamicListView::OnItemScrolledIntoViewInternal(ListItem, EntryWidget);
+	BP_OnItemScrolledIntoView.Broadcast(GetIndexForItem(ListItem), &EntryWidget);
+}
+
+void UDynamicIndexListView::OnListViewScrolledInternal(double ItemOffset, float DistanceRemaining)
+{
+	ITypedUMGDynamicListView::OnListViewScrolledInternal(ItemOffset, DistanceRemaining);
+
+	// The Blueprint event is shared with the engine list views and only takes floats
+	BP_OnListViewScrolled.Broadcast((float)ItemOffset, DistanceRemaining);
+}
+
+/////////////////////////////////////////////////////
+
+#undef LOCTEXT_NAMESPACE
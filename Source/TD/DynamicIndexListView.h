@@ -0,0 +1,283 @@
+#pragma once
+
+#include "DynamicListViewBase.h"
+#include "DynamicListItemHandle.h"
+#include "Components/ListViewBase.h"
+#include "DynamicIndexListView.generated.h"
+
+class SDynamicTableViewBase;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnListIndexEntryInitializedDynamic, int32, Index, UUserWidget*, Widget);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSimpleListIndexEventDynamic, int32, Index);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnListIndexIsHoveredChangedDynamic, int32, Index, bool, bIsHovered);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnListIndexSelectionChangedDynamic, int32, Index, bool, bIsSelected);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnListIndexScrolledIntoViewDynamic, int32, Index, UUserWidget*, Widget);
+
+/**
+ * List view whose rows stand for the elements of data held outside the list, e.g. a native struct array, rather than for item objects.
+ * The list only knows how many rows there are: each row is a plain handle, and entries implementing IUserIndexDynamicListEntry
+ * are given the index of the row they stand for, to read its data from wherever it is held.
+ * No object is made per row and nothing is reported to the garbage collector for them, which suits lists with a very large number of rows.
+ *
+ * Changes to the rows are told by index: SetNumItems, InsertItems, RemoveItems, MoveItems, and RefreshItems when the data of rows changed.
+ * Rows keep their entry, measured length and selection across changes to the rows around them.
+ */
+UCLASS(meta = (EntryInterface = UserIndexDynamicListEntry))
+class UDynamicIndexListView : public UDynamicListViewBase, public ITypedUMGDynamicListView<FDynamicListItemHandle>
+{
+	GENERATED_BODY()
+
+	IMPLEMENT_TYPED_UMG_DYNAMIC_LIST(FDynamicListItemHandle, MyListView)
+
+public:
+	UDynamicIndexListView(const FObjectInitializer& Initializer);
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+	ESelectionMode::Type GetSelectionMode() const { return SelectionMode; }
+	EOrientation GetOrientation() const { return Orientation; }
+
+	/** Returns the handle standing for the row at the given index, the null handle if the index is out of range */
+	FDynamicListItemHandle GetItemAt(int32 Index) const;
+
+	/** Returns the index of the row the given handle stands for, or -1 if it is not in the list */
+	int32 GetIndexForItem(const FDynamicListItemHandle& Item) const;
+
+	/**
+	 * Sets the number of rows, e.g. to the number of elements of the array they stand for.
+	 * Rows are added or removed at the end, the others keep their entry, measured length and selection.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void SetNumItems(int32 NumItems);
+
+	/** Returns the total number of rows */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	int32 GetNumItems() const;
+
+	/**
+	 * Inserts rows before the row at the given index, e.g. after elements were inserted into the array they stand for.
+	 * Only the new rows are measured, and the selection and the rows in view are kept.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void InsertItems(int32 Index, int32 NumItems);
+
+	/** Removes the given number of rows, starting at the given index. The remaining rows keep their measured lengths. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void RemoveItems(int32 Index, int32 NumItems);
+
+	/** Moves the given number of consecutive rows so that the first of them ends up at ToIndex. The moved rows keep their measured lengths. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void MoveItems(int32 FromIndex, int32 NumItems, int32 ToIndex);
+
+	/**
+	 * Tells that the data of the given rows changed: their entries in view are given their index again, and the rows are measured again.
+	 * The rows stay selected.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void RefreshItems(int32 Index, int32 NumItems);
+
+	/** Removes all rows from the list */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void ClearListItems();
+
+	/** Returns the index of the row the given entry widget currently represents, or -1 if it represents none */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	int32 GetIndexForEntryWidget(const UUserWidget* EntryWidget) const;
+
+	/** Returns the entry widget representing the row at the given index, if it is currently generated */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	UUserWidget* GetEntryWidgetFromIndex(int32 Index) const;
+
+	/** Sets the new selection mode, preserving the current selection where possible. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void SetSelectionMode(TEnumAsByte<ESelectionMode::Type> SelectionMode);
+
+	/** Sets the row at the given index as the sole selected row. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void SetSelectedIndex(int32 Index);
+
+	/** Sets whether the row at the given index is selected. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void SetIndexSelection(int32 Index, bool bSelected);
+
+	/** Gets the index of the first selected row, or -1 if there is none; recommended that you only use this for single selection lists. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	int32 GetSelectedIndex() const;
+
+	/** Gets the indices of all the currently selected rows, in no particular order */
+	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = ListView)
+	bool GetSelectedIndices(TArray<int32>& Indices) const;
+
+	/** Returns true if the row at the given index is selected */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	bool IsIndexSelected(int32 Index) const;
+
+	/** Returns true if the entry for the row at the given index is currently visible in the list */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	bool IsIndexVisible(int32 Index) const;
+
+	/** Returns true if a refresh is pending and the list will be rebuilt on the next tick */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	bool IsRefreshPending() const;
+
+	/** Requests that the row at the given index is scrolled into view */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void ScrollIndexIntoView(int32 Index);
+
+	/**
+	 * Requests that the row at the given index is scrolled to the given place in the view, in a single scroll.
+	 * IntoView scrolls as little as possible to show the whole entry, the others align it with the start, center or end of the view.
+	 * Padding is the space left between the entry and the edge of the view it is brought next to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void ScrollIndexIntoViewAligned(int32 Index, EDescendantScrollDestination Alignment = EDescendantScrollDestination::IntoView, float Padding = 0.f);
+
+	/** Requests that the row at the given index navigated to, scrolling it into view if needed. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void NavigateToIndex(int32 Index);
+
+protected:
+	/**
+	 * Gives the length of the entry for the row at the given index along the scroll axis, entry spacing excluded, when it is known from the data alone.
+	 * Only called when bGetEntryLengthsFromItems is set. Entries this returns true for are never instantiated just to be measured.
+	 *
+	 * @return True if OutLength was set, false to measure the entry widget instead.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = ListView)
+	bool GetEntryLengthForIndex(int32 Index, float& OutLength) const;
+	virtual bool GetEntryLengthForIndex_Implementation(int32 Index, float& OutLength) const;
+
+	TOptional<float> HandleGetItemLength(FDynamicListItemHandle Item) const;
+
+	/** Makes a handle standing for a new row */
+	FDynamicListItemHandle MakeItemHandle();
+
+	/** The first entry is the only one without spacing: measure again the entries that became or stopped being the first one */
+	void InvalidateFirstEntryLengths(FDynamicListItemHandle PreviousFirstItem);
+
+	virtual TSharedRef<SDynamicTableViewBase> RebuildListWidget() override;
+	virtual void HandleListEntryHovered(UUserWidget& EntryWidget) override;
+	virtual void HandleListEntryUnhovered(UUserWidget& EntryWidget) override;
+
+#if WITH_EDITOR
+	virtual void OnRefreshDesignerItems() override;
+#endif
+
+	virtual UUserWidget& OnGenerateEntryWidgetInternal(FDynamicListItemHandle Item, TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<SDynamicTableViewBase>& OwnerTable) override;
+	virtual FMargin GetDesiredEntryPadding(FDynamicListItemHandle Item) const override;
+
+	virtual void OnItemClickedInternal(FDynamicListItemHandle Item) override;
+	virtual void OnItemDoubleClickedInternal(FDynamicListItemHandle Item) override;
+	virtual void OnSelectionChangedInternal(FDynamicListItemHandle FirstSelectedItem) override;
+	virtual void OnItemScrolledIntoViewInternal(FDynamicListItemHandle Item, UUserWidget& EntryWidget) override;
+	virtual void OnListViewScrolledInternal(double ItemOffset, float DistanceRemaining) override;
+
+	void HandleOnEntryInitializedInternal(FDynamicListItemHandle Item, const TSharedRef<ITableRow>& TableRow);
+
+	/** SListView construction helper - useful if using a custom SDynamicListView subclass */
+	template <template<typename> class ListViewT = SDynamicListView>
+	TSharedRef<ListViewT<FDynamicListItemHandle>> ConstructListView()
+	{
+		FListViewConstructArgs Args;
+		Args.bAllowFocus = bIsFocusable;
+		Args.SelectionMode = SelectionMode;
+		Args.bClearSelectionOnClick = bClearSelectionOnClick;
+		Args.ConsumeMouseWheel = ConsumeMouseWheel;
+		Args.bReturnFocusToSelection = bReturnFocusToSelection;
+		Args.Orientation = Orientation;
+		Args.ListViewStyle = &WidgetStyle;
+		Args.ScrollBarStyle = &ScrollBarStyle;
+		MyListView = ITypedUMGDynamicListView<FDynamicListItemHandle>::ConstructListView<ListViewT>(this, ListItems, Args);
+
+		MyListView->SetOnEntryInitialized(SDynamicListView<FDynamicListItemHandle>::FOnEntryInitialized::CreateUObject(this, &UDynamicIndexListView::HandleOnEntryInitializedInternal));
+		if (bGetEntryLengthsFromItems)
+		{
+			MyListView->SetOnGetItemLength(SDynamicListView<FDynamicListItemHandle>::FOnGetItemLength::CreateUObject(this, &UDynamicIndexListView::HandleGetItemLength));
+		}
+
+		return StaticCastSharedRef<ListViewT<FDynamicListItemHandle>>(MyListView.ToSharedRef());
+	}
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView, meta = (DisplayName = "Style"))
+	FTableViewStyle WidgetStyle;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	FScrollBarStyle ScrollBarStyle;
+
+	/** The scroll & layout orientation of the list. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	TEnumAsByte<EOrientation> Orientation;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	TEnumAsByte<ESelectionMode::Type> SelectionMode = ESelectionMode::Single;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	EConsumeMouseWheel ConsumeMouseWheel = EConsumeMouseWheel::WhenScrollingPossible;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	bool bClearSelectionOnClick = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	bool bIsFocusable = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView, meta = (ClampMin = 0))
+	float EntrySpacing = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	bool bReturnFocusToSelection = false;
+
+	/** True to get entry lengths from GetEntryLengthForIndex, rather than by measuring entry widgets, whenever it provides one */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	bool bGetEntryLengthsFromItems = false;
+
+	/** One handle per row. Plain values, deliberately not a property: there is nothing in them for the garbage collector. */
+	TArray<FDynamicListItemHandle> ListItems;
+
+	/** Identifier of the last handle made */
+	uint32 LastItemHandleId = 0;
+
+	TSharedPtr<SDynamicListView<FDynamicListItemHandle>> MyListView;
+
+private:
+	// BP exposure of ITypedUMGDynamicListView API
+
+	/** Clear selection */
+	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Clear Selection"))
+	void BP_ClearSelection();
+
+	/** Gets the number of rows currently selected in the list */
+	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Get Num Items Selected"))
+	int32 BP_GetNumItemsSelected() const;
+
+	/** Measures the entry of the row at the given index again on the next tick, e.g. after its content changed size. */
+	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Invalidate Index Length"))
+	void BP_InvalidateIndexLength(int32 Index);
+
+	/** Cancels a previous request to scroll and item into view. */
+	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Cancel Scroll Into View"))
+	void BP_CancelScrollIntoView();
+
+private:
+	/** Called when a row widget is generated for a row */
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On Entry Initialized"))
+	FOnListIndexEntryInitializedDynamic BP_OnEntryInitialized;
+
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On Item Clicked"))
+	FSimpleListIndexEventDynamic BP_OnItemClicked;
+
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On Item Double Clicked"))
+	FSimpleListIndexEventDynamic BP_OnItemDoubleClicked;
+
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On Item Is Hovered Changed"))
+	FOnListIndexIsHoveredChangedDynamic BP_OnItemIsHoveredChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On Item Selection Changed"))
+	FOnListIndexSelectionChangedDynamic BP_OnItemSelectionChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On Item Scrolled Into View"))
+	FOnListIndexScrolledIntoViewDynamic BP_OnItemScrolledIntoView;
+
+	UPROPERTY(BlueprintAssignable, Category = Events, meta = (DisplayName = "On List View Scrolled"))
+	FOnListViewScrolledDynamic BP_OnListViewScrolled;
+};
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/**
+ * Items observed by a dynamic list view, produced by index when the view asks for them instead of all held in an array.
+ * The view only asks for the items it generates rows for, measures or navigates to:
+ * it always starts from estimated item lengths, and keeps the measured lengths by position rather than by item.
+ *
+ * The view keys its rows by item, so GetItem must return the same item for the same entry for as long as that entry is in the source,
+ * e.g. by keeping the items it made for the entries in view. Selected entries are kept by index, and follow the changes reported below.
+ * Changes to the entries are reported to the view the same way as changes to an items array:
+ * NotifyItemsInserted, NotifyItemsRemoved, NotifyItemsMoved, NotifyItemsReplaced or RequestListRefresh.
+ * Sources whose entries change on their own, e.g. feeds or followed files, broadcast OnItemsInserted and OnItemsRemoved instead.
+ * Sources swapping the items of entries that did not change, e.g. placeholders for loaded items, broadcast OnItemsRefreshed instead.
+ */
+template <typename ItemType>
+class IDynamicListDataSource
+{
+public:
+	virtual ~IDynamicListDataSource() = default;
+
+	/** @return The number of items. */
+	virtual int32 Num() const = 0;
+
+	/** @return The item at the given index, which is valid. */
+	virtual ItemType GetItem(int32 Index) const = 0;
+
+	/**
+	 * Find where an item is without going through every item.
+	 * When this is not overridden the view indexes the items itself, which makes every one of them.
+	 *
+	 * @return The index of the item, INDEX_NONE if it is not in the source, or unset if the source cannot tell.
+	 */
+	virtual TOptional<int32> FindIndexOfItem(const ItemType& Item) const { return TOptional<int32>(); }
+
+	/**
+	 * Length of an item along the scroll axis, for sources that know it from the data alone.
+	 * Items with a length are neither made nor measured with a widget to lay out the list.
+	 */
+	virtual TOptional<float> GetItemLengthHint(int32 Index) const { return TOptional<float>(); }
+
+	/**
+	 * Called by the view before it generates rows for the items from FirstIndex to LastIndex included,
+	 * for sources that load their items around the ones in view.
+	 */
+	virtual void SetItemsInView(int32 FirstIndex, int32 LastIndex, bool bScrollingBackward) {}
+
+	/**
+	 * Broadcast with the index and number of items that were swapped for other items standing for the same entries.
+	 * The view observing the source generates rows for the new items and measures them again, and keeps the entries selected.
+	 */
+	TMulticastDelegate<void(int32, int32)>& OnItemsRefreshed() { return ItemsRefreshedEvent; }
+
+	/** Broadcast with the index and number of items the source inserted, after they were inserted. The view observing the source is notified of them. */
+	TMulticastDelegate<void(int32, int32)>& OnItemsInserted() { return ItemsInsertedEvent; }
+
+	/** Broadcast with the index and number of items the source removed, after they were removed. The view observing the source is notified of them. */
+	TMulticastDelegate<void(int32, int32)>& OnItemsRemoved() { return ItemsRemovedEvent; }
+
+protected:
+	TMulticastDelegate<void(int32, int32)> ItemsRefreshedEvent;
+	TMulticastDelegate<void(int32, int32)> ItemsInsertedEvent;
+	TMulticastDelegate<void(int32, int32)> ItemsRemovedEvent;
+};
+
+/** Data source observing an array, for code written against IDynamicListDataSource that also lists items held in memory. */
+template <typename ItemType>
+class TDynamicListArrayDataSource : public IDynamicListDataSource<ItemType>
+{
+public:
+	explicit TDynamicListArrayDataSource(const TArray<ItemType>* InItems)
+		: Items(InItems)
+	{
+	}
+
+	virtual int32 Num() const override { return Items ? Items->Num() : 0; }
+	virtual ItemType GetItem(int32 Index) const override { return (*Items)[Index]; }
+
+private:
+	const TArray<ItemType>* Items;
+};
+
+/**
+ * The items a dynamic list view observes, as it reads them.
+ * Indexes the items array directly when the view observes one, and asks the data source otherwise.
+ */
+template <typename ItemType>
+class TDynamicListItems
+{
+public:
+	TDynamicListItems() = default;
+
+	explicit TDynamicListItems(TArrayView<const ItemType> InArrayItems)
+		: ArrayItems(InArrayItems)
+	{
+	}
+
+	explicit TDynamicListItems(const IDynamicListDataSource<ItemType>* InDataSource)
+		: DataSource(InDataSource)
+	{
+	}
+
+	int32 Num() const
+	{
+		return DataSource ? DataSource->Num() : ArrayItems.Num();
+	}
+
+	bool IsValidIndex(int32 Index) const
+	{
+		return Index >= 0 && Index < Num();
+	}
+
+	ItemType operator[](int32 Index) const
+	{
+		return DataSource ? DataSource->GetItem(Index) : ArrayItems[Index];
+	}
+
+	ItemType Last() const
+	{
+		return (*this)[Num() - 1];
+	}
+
+	/** @return The index of the first occurrence of the item, INDEX_NONE if there is none. Goes through the items when the data source cannot tell. */
+	int32 Find(const ItemType& Item) const
+	{
+		if (DataSource == nullptr)
+		{
+			return ArrayItems.Find(Item);
+		}
+
+		if (const TOptional<int32> ItemIndex = DataSource->FindIndexOfItem(Item))
+		{
+			return ItemIndex.GetValue();
+		}
+
+		for (int32 ItemIndex = 0; ItemIndex < DataSource->Num(); ++ItemIndex)
+		{
+			if (DataSource->GetItem(ItemIndex) == Item)
+			{
+				return ItemIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/** @return The data source the items come from, null when they come from an array. */
+	const IDynamicListDataSource<ItemType>* GetDataSource() const { return DataSource; }
+
+private:
+	TArrayView<const ItemType> ArrayItems;
+	const IDynamicListDataSource<ItemType>* DataSource = nullptr;
+};
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicListDataSource.h"
+
+/**
+ * Data source for append-only feeds, e.g. chat or log messages, keeping the last Capacity items in a ring buffer.
+ * Appending is O(1): items are written after the last one, and the view observing the source only measures the new entries.
+ * Once the buffer is full the oldest items are evicted from the start of the list, a batch at a time,
+ * so that the view, which shifts its remaining entries when the first ones are removed, does so once per batch rather than once per item.
+ * Pair with the view's StickToEnd to follow the feed while the user is at its end, and keep the entries in view where they are otherwise.
+ *
+ * Items must be unique and hashable, they are found in O(1) through the order they were appended in.
+ * Object items must be kept alive by whoever provides them.
+ */
+template <typename ItemType>
+class TDynamicListFeedDataSource : public IDynamicListDataSource<ItemType>
+{
+public:
+	/**
+	 * @param InCapacity			Most items kept.
+	 * @param InEvictionBatchSize	Items evicted at once when the buffer is full, 0 for a sixteenth of the capacity.
+	 */
+	explicit TDynamicListFeedDataSource(int32 InCapacity, int32 InEvictionBatchSize = 0)
+		: Capacity(FMath::Max(InCapacity, 1))
+	{
+		EvictionBatchSize = InEvictionBatchSize > 0 ? FMath::Min(InEvictionBatchSize, Capacity) : FMath::Max(Capacity / 16, 1);
+	}
+
+	// IDynamicListDataSource interface
+	virtual int32 Num() const override
+	{
+		return NumItems;
+	}
+
+	virtual ItemType GetItem(int32 Index) const override
+	{
+		return Slots[GetSlotIndex(Index)];
+	}
+
+	virtual TOptional<int32> FindIndexOfItem(const ItemType& Item) const override
+	{
+		const uint64* Sequence = ItemSequences.Find(Item);
+		return Sequence ? static_cast<int32>(*Sequence - FirstSequence) : INDEX_NONE;
+	}
+	// End of IDynamicListDataSource interface
+
+	/** Appends an item at the end of the feed, evicting the oldest items first if it is full. Items already in the feed are skipped. */
+	void Append(const ItemType& Item)
+	{
+		AppendItems(MakeArrayView(&Item, 1));
+	}
+
+	/** Appends items at the end of the feed, evicting the oldest items as it fills up. Items already in the feed are skipped. */
+	void AppendItems(TArrayView<const ItemType> Items)
+	{
+		int32 FirstNewIndex = NumItems;
+		for (const ItemType& Item : Items)
+		{
+			if (ItemSequences.Contains(Item))
+			{
+				continue;
+			}
+
+			if (NumItems == Capacity)
+			{
+				// The items appended so far are reported before the ones before them are evicted, which moves them
+				if (NumItems > FirstNewIndex)
+				{
+					this->ItemsInsertedEvent.Broadcast(FirstNewIndex, NumItems - FirstNewIndex);
+				}
+				EvictOldest(EvictionBatchSize);
+				FirstNewIndex = NumItems;
+			}
+
+			// Slots are filled in order until the buffer first wraps around, past that they are reused
+			const int32 SlotIndex = GetSlotIndex(NumItems);
+			if (SlotIndex == Slots.Num())
+			{
+				Slots.Add(Item);
+			}
+			else
+			{
+				Slots[SlotIndex] = Item;
+			}
+
+			ItemSequences.Add(Item, FirstSequence + NumItems);
+			++NumItems;
+		}
+
+		if (NumItems > FirstNewIndex)
+		{
+			this->ItemsInsertedEvent.Broadcast(FirstNewIndex, NumItems - FirstNewIndex);
+		}
+	}
+
+	/** Removes the given number of items from the start of the feed */
+	void EvictOldest(int32 NumItemsToEvict)
+	{
+		NumItemsToEvict = FMath::Clamp(NumItemsToEvict, 0, NumItems);
+		if (NumItemsToEvict == 0)
+		{
+			return;
+		}
+
+		for (int32 EvictedIndex = 0; EvictedIndex < NumItemsToEvict; ++EvictedIndex)
+		{
+			ItemSequences.Remove(Slots[FirstSlot]);
+			Slots[FirstSlot] = ItemType();
+			FirstSlot = (FirstSlot + 1) % Capacity;
+		}
+		NumItems -= NumItemsToEvict;
+		FirstSequence += NumItemsToEvict;
+
+		this->ItemsRemovedEvent.Broadcast(0, NumItemsToEvict);
+	}
+
+	/** Removes every item */
+	void Reset()
+	{
+		const int32 NumRemovedItems = NumItems;
+		Slots.Reset();
+		ItemSequences.Reset();
+		FirstSlot = 0;
+		NumItems = 0;
+		FirstSequence += NumRemovedItems;
+
+		if (NumRemovedItems > 0)
+		{
+			this->ItemsRemovedEvent.Broadcast(0, NumRemovedItems);
+		}
+	}
+
+	int32 GetCapacity() const { return Capacity; }
+
+	bool IsFull() const { return NumItems == Capacity; }
+
+private:
+	int32 GetSlotIndex(int32 Index) const
+	{
+		return static_cast<int32>((static_cast<int64>(FirstSlot) + Index) % Capacity);
+	}
+
+	int32 Capacity;
+	int32 EvictionBatchSize;
+
+	/** The ring buffer, grown up to Capacity as items are first appended */
+	TArray<ItemType> Slots;
+
+	/** Slot of the first item */
+	int32 FirstSlot = 0;
+	int32 NumItems = 0;
+
+	/** How many items were appended before the first one, so that the index of an item is its sequence minus this */
+	uint64 FirstSequence = 0;
+
+	/** The sequence of every item, in the order they were appended */
+	TMap<ItemType, uint64> ItemSequences;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Views/TableViewTypeTraits.h"
+
+/**
+ * Item of a list whose rows stand for data held outside the list, e.g. the elements of a native struct array.
+ * Only an identifier: the list keys its entries, selection and measured lengths by it, and the data is looked up by the index of the row.
+ * A handle keeps standing for the same row when rows are inserted, removed or moved around it.
+ */
+struct FDynamicListItemHandle
+{
+	FDynamicListItemHandle() = default;
+
+	/** The null handle, for the list code written against pointer items */
+	FDynamicListItemHandle(TYPE_OF_NULLPTR)
+	{
+	}
+
+	explicit FDynamicListItemHandle(uint64 InId)
+		: Id(InId)
+	{
+	}
+
+	bool IsValid() const { return Id != 0; }
+
+	uint64 GetId() const { return Id; }
+
+	bool operator==(const FDynamicListItemHandle& Other) const { return Id == Other.Id; }
+	bool operator!=(const FDynamicListItemHandle& Other) const { return Id != Other.Id; }
+
+	friend uint32 GetTypeHash(const FDynamicListItemHandle& Handle)
+	{
+		return ::GetTypeHash(Handle.Id);
+	}
+
+private:
+	/** 0 for the null handle */
+	uint64 Id = 0;
+};
+
+/** Handles are plain values: nothing to report to the garbage collector, and the null handle stands for the null item. */
+template <>
+struct TListTypeTraits<FDynamicListItemHandle>
+{
+public:
+	typedef FDynamicListItemHandle NullableType;
+
+	using MapKeyFuncs = TDefaultMapHashableKeyFuncs<FDynamicListItemHandle, TSharedRef<ITableRow>, false>;
+	using MapKeyFuncsSparse = TDefaultMapHashableKeyFuncs<FDynamicListItemHandle, FSparseItemInfo, false>;
+	using SetKeyFuncs = DefaultKeyFuncs<FDynamicListItemHandle>;
+
+	template <typename ItemArrayType, typename ItemSetType, typename WidgetMapType>
+	static void AddReferencedObjects(FReferenceCollector& Collector, ItemArrayType& ItemsWithGeneratedWidgets, ItemSetType& SelectedItems, WidgetMapType& WidgetToItemMap)
+	{
+	}
+
+	static bool IsPtrValid(const FDynamicListItemHandle& InHandle) { return InHandle.IsValid(); }
+
+	static void ResetPtr(FDynamicListItemHandle& InHandle) { InHandle = FDynamicListItemHandle(); }
+
+	static FDynamicListItemHandle MakeNullPtr() { return FDynamicListItemHandle(); }
+
+	static FDynamicListItemHandle NullableItemTypeConvertToItemType(const FDynamicListItemHandle& InHandle) { return InHandle; }
+
+	static FString DebugDump(FDynamicListItemHandle InHandle)
+	{
+		return InHandle.IsValid() ? FString::Printf(TEXT("Handle %llu"), InHandle.GetId()) : FString(TEXT("nullptr"));
+	}
+
+	class SerializerType{};
+};
+
+template <>
+struct TIsValidListItem<FDynamicListItemHandle>
+{
+	enum
+	{
+		Value = true
+	};
+};
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * How a dynamic list identifies an item in its length cache.
+ * By default the item itself is the key and it never expires.
+ */
+template <typename ItemType, typename Enable = void>
+struct TDynamicListItemKeyTraits
+{
+	using KeyType = ItemType;
+
+	/** True if keys can outlive their item and need to be purged */
+	static constexpr bool bCanExpire = false;
+
+	static KeyType MakeKey(const ItemType& Item) { return Item; }
+	static bool IsExpired(const KeyType& Key) { return false; }
+};
+
+/** UObject items are keyed without keeping them alive, their keys expire when the object is garbage collected. */
+template <typename ObjectType>
+struct TDynamicListItemKeyTraits<ObjectType*, typename TEnableIf<TIsDerivedFrom<ObjectType, UObject>::Value>::Type>
+{
+	using KeyType = FObjectKey;
+
+	static constexpr bool bCanExpire = true;
+
+	static KeyType MakeKey(const ObjectType* Item) { return FObjectKey(Item); }
+	static bool IsExpired(const KeyType& Key) { return Key.ResolveObjectPtr() == nullptr; }
+};
+
+/** Key of a shared item that does not keep it alive */
+template <typename ObjectType, ESPMode Mode>
+struct TDynamicListWeakItemKey
+{
+	const ObjectType* Object = nullptr;
+	TWeakPtr<ObjectType, Mode> WeakObject;
+
+	/** Keys only match while their items are alive, so that an item allocated where a released one was does not get its length */
+	bool operator==(const TDynamicListWeakItemKey& Other) const
+	{
+		return Object == Other.Object && WeakObject.IsValid() && Other.WeakObject.IsValid();
+	}
+
+	friend uint32 GetTypeHash(const TDynamicListWeakItemKey& Key)
+	{
+		return PointerHash(Key.Object);
+	}
+};
+
+/** Shared items are keyed without keeping them alive, their keys expire when the item is released. */
+template <typename ObjectType, ESPMode Mode>
+struct TDynamicListItemKeyTraits<TSharedPtr<ObjectType, Mode>>
+{
+	using KeyType = TDynamicListWeakItemKey<ObjectType, Mode>;
+
+	static constexpr bool bCanExpire = true;
+
+	static KeyType MakeKey(const TSharedPtr<ObjectType, Mode>& Item) { return KeyType{ Item.Get(), Item }; }
+	static bool IsExpired(const KeyType& Key) { return !Key.WeakObject.IsValid(); }
+};
+
+template <typename ObjectType, ESPMode Mode>
+struct TDynamicListItemKeyTraits<TSharedRef<ObjectType, Mode>>
+{
+	using KeyType = TDynamicListWeakItemKey<ObjectType, Mode>;
+
+	static constexpr bool bCanExpire = true;
+
+	static KeyType MakeKey(const TSharedRef<ObjectType, Mode>& Item) { return KeyType{ &Item.Get(), Item }; }
+	static bool IsExpired(const KeyType& Key) { return !Key.WeakObject.IsValid(); }
+};
+
+/** Everything an item length depends on besides the item, a cached length is only reused when all of it matches. */
+struct FDynamicListItemLengthContext
+{
+	/** Class of the entry widget the item was measured with */
+	FObjectKey EntryClass;
+
+	float LayoutScaleMultiplier = 0.f;
+
+	/** Size of the items panel along the line axis */
+	float LineAxisLength = 0.f;
+
+	bool operator==(const FDynamicListItemLengthContext& Other) const
+	{
+		return EntryClass == Other.EntryClass && LayoutScaleMultiplier == Other.LayoutScaleMultiplier && LineAxisLength == Other.LineAxisLength;
+	}
+};
+
+/**
+ * Measured item lengths keyed by item identity rather than position,
+ * so that they survive the items being re-ordered, filtered or moved to a different items source.
+ * The cache holds at most MaxNum lengths, past it the least recently used ones are forgotten, e.g. those of value items that were removed.
+ */
+template <typename ItemType>
+class TDynamicListItemLengthCache
+{
+public:
+	using FKeyTraits = TDynamicListItemKeyTraits<ItemType>;
+
+	/** @return The length the item was measured with in the given context, if any. */
+	TOptional<float> Find(const ItemType& Item, const FDynamicListItemLengthContext& Context) const
+	{
+		const FEntry* Entry = Entries.Find(FKeyTraits::MakeKey(Item));
+		if (Entry && Entry->Context == Context)
+		{
+			Entry->LastUseCount = ++UseCount;
+			return Entry->Length;
+		}
+		return TOptional<float>();
+	}
+
+	/** Remember the length the item was measured with in the given context. */
+	void Add(const ItemType& Item, const FDynamicListItemLengthContext& Context, float InLength)
+	{
+		Entries.Add(FKeyTraits::MakeKey(Item), FEntry{ Context, InLength, ++UseCount });
+		if (MaxNum > 0 && Entries.Num() > MaxNum)
+		{
+			TrimLeastRecentlyUsed();
+		}
+	}
+
+	/** Forget the length of the item, so that it gets measured again. */
+	void Remove(const ItemType& Item)
+	{
+		Entries.Remove(FKeyTraits::MakeKey(Item));
+	}
+
+	void Reset()
+	{
+		Entries.Reset();
+	}
+
+	/** Forget the lengths of the items that no longer exist. */
+	void PurgeExpired()
+	{
+		if (FKeyTraits::bCanExpire)
+		{
+			for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
+			{
+				if (FKeyTraits::IsExpired(EntryIt.Key()))
+				{
+					EntryIt.RemoveCurrent();
+				}
+			}
+		}
+	}
+
+	int32 Num() const { return Entries.Num(); }
+
+	/** Sets the most lengths kept, 0 for no limit. Applied as lengths are added. */
+	void SetMaxNum(int32 InMaxNum)
+	{
+		MaxNum = FMath::Max(InMaxNum, 0);
+	}
+
+private:
+	struct FEntry
+	{
+		FDynamicListItemLengthContext Context;
+		float Length = 0.f;
+
+		/** UseCount when the length was last added or found */
+		mutable uint64 LastUseCount = 0;
+	};
+
+	/** Forget the least recently used lengths, down to three quarters of MaxNum so that trimming is not done on every add */
+	void TrimLeastRecentlyUsed()
+	{
+		PurgeExpired();
+
+		const int32 NumToKeep = MaxNum - MaxNum / 4;
+		if (Entries.Num() <= NumToKeep)
+		{
+			return;
+		}
+
+		TArray<uint64> UseCounts;
+		UseCounts.Reserve(Entries.Num());
+		for (const TPair<typename FKeyTraits::KeyType, FEntry>& Entry : Entries)
+		{
+			UseCounts.Add(Entry.Value.LastUseCount);
+		}
+		UseCounts.Sort();
+
+		const uint64 OldestUseCountKept = UseCounts[UseCounts.Num() - NumToKeep];
+		for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
+		{
+			if (EntryIt.Value().LastUseCount < OldestUseCountKept)
+			{
+				EntryIt.RemoveCurrent();
+			}
+		}
+	}
+
+	TMap<typename FKeyTraits::KeyType, FEntry> Entries;
+
+	int32 MaxNum = 0;
+	mutable uint64 UseCount = 0;
+};
@@ -0,0 +1,141 @@
+#include "DynamicListItemLengths.h"
+
+namespace DynamicListItemLengths
+{
+	static int32 LowestBit(int32 Value)
+	{
+		return Value & -Value;
+	}
+}
+
+void FDynamicListItemLengths::Reset(int32 NumItemsToReserve)
+{
+	Lengths.Reset(NumItemsToReserve);
+	Tree.Reset(NumItemsToReserve + 1);
+	Tree.Add(0.);
+	TotalLength = 0.;
+}
+
+void FDynamicListItemLengths::Add(float InLength)
+{
+	if (Tree.Num() == 0)
+	{
+		Tree.Add(0.);
+	}
+
+	Lengths.Add(InLength);
+
+	Tree.Add(SumNodeFromChildren(Lengths.Num()));
+
+	TotalLength += InLength;
+}
+
+void FDynamicListItemLengths::SetLength(int32 Index, float InLength)
+{
+	check(Lengths.IsValidIndex(Index));
+
+	const double Delta = (double)InLength - (double)Lengths[Index];
+	if (Delta == 0.)
+	{
+		return;
+	}
+
+	Lengths[Index] = InLength;
+	for (int32 TreeIndex = Index + 1; TreeIndex < Tree.Num(); TreeIndex += DynamicListItemLengths::LowestBit(TreeIndex))
+	{
+		Tree[TreeIndex] += Delta;
+	}
+
+	TotalLength += Delta;
+}
+
+void FDynamicListItemLengths::Insert(int32 Index, TArrayView<const float> InLengths)
+{
+	check(Index >= 0 && Index <= Lengths.Num());
+
+	if (InLengths.Num() > 0)
+	{
+		Lengths.Insert(InLengths.GetData(), InLengths.Num(), Index);
+		RebuildFrom(Index);
+	}
+}
+
+void FDynamicListItemLengths::RemoveAt(int32 Index, int32 Count)
+{
+	check(Index >= 0 && Count >= 0 && Index + Count <= Lengths.Num());
+
+	if (Count > 0)
+	{
+		Lengths.RemoveAt(Index, Count);
+		RebuildFrom(Index);
+	}
+}
+
+void FDynamicListItemLengths::RebuildFrom(int32 Index)
+{
+	// Nodes up to Index only cover the items before it, which did not move. The others are added back as if their items were appended again.
+	if (Tree.Num() == 0)
+	{
+		Tree.Add(0.);
+	}
+	Tree.SetNum(Index + 1);
+	TotalLength = PrefixSum(Index);
+
+	for (int32 TreeIndex = Index + 1; TreeIndex <= Lengths.Num(); ++TreeIndex)
+	{
+		Tree.Add(SumNodeFromChildren(TreeIndex));
+		TotalLength += Lengths[TreeIndex - 1];
+	}
+}
+
+double FDynamicListItemLengths::SumNodeFromChildren(int32 TreeIndex) const
+{
+	// The node's block is its own item after the blocks of the nodes just before it, halving in size down to 1.
+	// Half the nodes have no children and a quarter have one, so building nodes in order is O(1) each on average.
+	double Sum = Lengths[TreeIndex - 1];
+	const int32 BlockSize = DynamicListItemLengths::LowestBit(TreeIndex);
+	for (int32 ChildBlockSize = 1; ChildBlockSize < BlockSize; ChildBlockSize <<= 1)
+	{
+		Sum += Tree[TreeIndex - ChildBlockSize];
+	}
+	return Sum;
+}
+
+double FDynamicListItemLengths::GetOffsetOf(int32 Index) const
+{
+	return PrefixSum(FMath::Clamp(Index, 0, Lengths.Num()));
+}
+
+int32 FDynamicListItemLengths::FindIndexAtOffset(double Offset) const
+{
+	const int32 NumItems = Lengths.Num();
+	if (NumItems == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Descend the tree, skipping every block of items that ends at or before the requested offset
+	int32 NumItemsBefore = 0;
+	double RemainingOffset = Offset;
+	for (int32 Step = 1 << FMath::FloorLog2(NumItems); Step > 0; Step >>= 1)
+	{
+		const int32 TreeIndex = NumItemsBefore + Step;
+		if (TreeIndex <= NumItems && Tree[TreeIndex] <= RemainingOffset)
+		{
+			NumItemsBefore = TreeIndex;
+			RemainingOffset -= Tree[TreeIndex];
+		}
+	}
+
+	return FMath::Min(NumItemsBefore, NumItems - 1);
+}
+
+double FDynamicListItemLengths::PrefixSum(int32 Count) const
+{
+	double Sum = 0.;
+	for (int32 TreeIndex = Count; TreeIndex > 0; TreeIndex -= DynamicListItemLengths::LowestBit(TreeIndex))
+	{
+		Sum += Tree[TreeIndex];
+	}
+	return Sum;
+}
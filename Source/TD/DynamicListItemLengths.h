@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Length (along the scroll axis) of every item observed by a dynamic list, paired with a Fenwick tree of prefix sums.
+ * Answers "which item is at this offset" and "at which offset does this item start" in O(log N),
+ * and patches a single item's length in O(log N).
+ */
+class FDynamicListItemLengths
+{
+public:
+	/** Remove all lengths and reserve room for the given number of items. */
+	void Reset(int32 NumItemsToReserve = 0);
+
+	/** Append the length of the next item. */
+	void Add(float InLength);
+
+	/** Change the length of a single item. */
+	void SetLength(int32 Index, float InLength);
+
+	/** Insert the lengths of consecutive items before the item at the given index. O(N - Index), O(1) amortized per item when appending. */
+	void Insert(int32 Index, TArrayView<const float> InLengths);
+
+	/** Remove the lengths of consecutive items starting at the given index. O(N - Index). */
+	void RemoveAt(int32 Index, int32 Count);
+
+	/** @return The number of items we hold lengths for. */
+	int32 Num() const { return Lengths.Num(); }
+
+	bool IsValidIndex(int32 Index) const { return Lengths.IsValidIndex(Index); }
+
+	/** @return The length of the item at the given index. */
+	float GetLength(int32 Index) const { return Lengths[Index]; }
+
+	/** @return The offset from the beginning of the list at which the given item starts (i.e. the sum of all the preceding lengths). */
+	double GetOffsetOf(int32 Index) const;
+
+	/**
+	 * @return The index of the item covering the given offset from the beginning of the list.
+	 *         Offsets before the first item resolve to the first item, offsets past the end resolve to the last one.
+	 *         INDEX_NONE when there are no items.
+	 */
+	int32 FindIndexAtOffset(double Offset) const;
+
+	/** @return The sum of all lengths. */
+	double GetTotalLength() const { return TotalLength; }
+
+private:
+	/** Sum of the lengths of the first Count items. */
+	double PrefixSum(int32 Count) const;
+
+	/** Rebuild the tree nodes covering the items from the given index onwards, after those items changed places. */
+	void RebuildFrom(int32 Index);
+
+	/** @return The value of the given tree node from its item's length and its child nodes, which must be up to date. */
+	double SumNodeFromChildren(int32 TreeIndex) const;
+
+	/** Length of every item. */
+	TArray<float> Lengths;
+
+	/** 1-based Fenwick tree over Lengths; Tree[i] holds the sum of the LowestBit(i) lengths ending at item i - 1. */
+	TArray<double> Tree;
+
+	/** Sum of all lengths. */
+	double TotalLength = 0.;
+};
@@ -0,0 +1,332 @@
+#include "DynamicListLogFileSource.h"
+
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "SlateGlobals.h"
+
+namespace LogFileSourceConstants
+{
+	/** Bytes at the start of the file compared on every poll, to tell a file replaced by another one of the same size or larger */
+	static const int64 FileHeadSize = 1024;
+}
+
+const uint8* FDynamicListLogFileSource::FMappedFile::GetData() const
+{
+	return Region->GetMappedPtr();
+}
+
+int64 FDynamicListLogFileSource::FMappedFile::Num() const
+{
+	return Region->GetMappedSize();
+}
+
+FDynamicListLogFileSource::FDynamicListLogFileSource(const FString& InFilename, const FDynamicListLogFileSettings& InSettings)
+	: Filename(InFilename)
+	, Settings(InSettings)
+{
+	Settings.LinesPerCheckpoint = FMath::Max(Settings.LinesPerCheckpoint, 1);
+	Settings.MaxBytesPerIndexingTask = FMath::Max<int64>(Settings.MaxBytesPerIndexingTask, 1);
+
+	// Mapping the file does not read it, the lines are listed as the background tasks index them
+	MapFile();
+	LastFollowPollTime = FPlatformTime::Seconds();
+	LaunchIndexingTask();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDynamicListLogFileSource::Tick));
+}
+
+FDynamicListLogFileSource::~FDynamicListLogFileSource()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	// The task reads the stop flag, let it finish before it goes away
+	if (IndexingTask.IsValid())
+	{
+		bStopIndexing = true;
+		IndexingTask.Wait();
+	}
+}
+
+FDynamicListItemHandle FDynamicListLogFileSource::GetItem(int32 Index) const
+{
+	return FDynamicListItemHandle((static_cast<uint64>(IndexEpoch) << 32) | (static_cast<uint32>(Index) + 1));
+}
+
+TOptional<int32> FDynamicListLogFileSource::FindIndexOfItem(const FDynamicListItemHandle& Item) const
+{
+	return GetLineIndex(Item);
+}
+
+int32 FDynamicListLogFileSource::GetLineIndex(const FDynamicListItemHandle& Item) const
+{
+	// Handles made before the file was indexed anew stand for lines that are gone
+	if (!Item.IsValid() || static_cast<uint32>(Item.GetId() >> 32) != IndexEpoch)
+	{
+		return INDEX_NONE;
+	}
+
+	const int64 LineIndex = static_cast<int64>(Item.GetId() & MAX_uint32) - 1;
+	return LineIndex < NumLines ? static_cast<int32>(LineIndex) : INDEX_NONE;
+}
+
+FUtf8StringView FDynamicListLogFileSource::GetLine(int32 LineIndex) const
+{
+	if (!ensureMsgf(LineIndex >= 0 && LineIndex < NumLines, TEXT("Line %d of %s was read, only %d lines are indexed."), LineIndex, *Filename, NumLines))
+	{
+		return FUtf8StringView();
+	}
+
+	const uint8* Data = MappedFile->GetData();
+	const int64 LineStart = FindLineStart(LineIndex);
+
+	// Only the last line may not be terminated, when the whole file was indexed
+	const uint8* LineEnd = static_cast<const uint8*>(memchr(Data + LineStart, '\n', IndexedEnd - LineStart));
+	int64 LineLength = (LineEnd ? LineEnd - Data : IndexedEnd) - LineStart;
+	if (LineLength > 0 && Data[LineStart + LineLength - 1] == '\r')
+	{
+		--LineLength;
+	}
+
+	return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + LineStart), static_cast<int32>(FMath::Min<int64>(LineLength, MAX_int32)));
+}
+
+FString FDynamicListLogFileSource::GetLineText(int32 LineIndex) const
+{
+	const FUtf8StringView Line = GetLine(LineIndex);
+	const FUTF8ToTCHAR ConvertedLine(reinterpret_cast<const ANSICHAR*>(Line.GetData()), Line.Len());
+	return FString(ConvertedLine.Length(), ConvertedLine.Get());
+}
+
+bool FDynamicListLogFileSource::IsIndexing() const
+{
+	return IndexingTask.IsValid() || FMath::Max(IndexedEnd, ScannedEnd) < GetMappedSize();
+}
+
+float FDynamicListLogFileSource::GetIndexingProgress() const
+{
+	const int64 MappedSize = GetMappedSize();
+	return MappedSize > 0 ? static_cast<float>(static_cast<double>(FMath::Max(IndexedEnd, ScannedEnd)) / MappedSize) : 1.f;
+}
+
+bool FDynamicListLogFileSource::Tick(float DeltaTime)
+{
+	if (IndexingTask.IsValid())
+	{
+		if (!IndexingTask.IsReady())
+		{
+			return true;
+		}
+
+		const FIndexedChunk Chunk = IndexingTask.Get();
+		IndexingTask.Reset();
+		ApplyIndexedChunk(Chunk);
+	}
+
+	// Only map the file again between tasks, while nothing reads the previous mapping
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (Settings.bFollowAppends && CurrentTime - LastFollowPollTime >= Settings.FollowPollInterval)
+	{
+		LastFollowPollTime = CurrentTime;
+
+		const int64 FileSize = FMath::Max<int64>(FPlatformFileManager::Get().GetPlatformFile().FileSize(*Filename), 0);
+		const int64 MappedSize = GetMappedSize();
+		if (FileSize < MappedSize || IsFileReplaced())
+		{
+			ResetIndex();
+		}
+		else if (FileSize > MappedSize)
+		{
+			MapFile();
+		}
+	}
+
+	LaunchIndexingTask();
+	return true;
+}
+
+void FDynamicListLogFileSource::MapFile()
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 FileSize = PlatformFile.FileSize(*Filename);
+	if (FileSize == 0)
+	{
+		// Empty files cannot be mapped, they are mapped once they grow
+		bFailedToOpen = false;
+		return;
+	}
+
+	TSharedPtr<FMappedFile, ESPMode::ThreadSafe> NewMappedFile = MakeShared<FMappedFile, ESPMode::ThreadSafe>();
+	NewMappedFile->Handle.Reset(FileSize > 0 ? PlatformFile.OpenMapped(*Filename) : nullptr);
+	if (NewMappedFile->Handle.IsValid())
+	{
+		NewMappedFile->Region.Reset(NewMappedFile->Handle->MapRegion());
+	}
+
+	if (NewMappedFile->Region.IsValid())
+	{
+		// A task still indexing the previous mapping holds on to it until it is done
+		MappedFile = NewMappedFile;
+		bFailedToOpen = false;
+
+		// Remember the start of the file to tell when it is replaced, taking more of it as it grows up to FileHeadSize
+		const int64 HeadSize = FMath::Min(MappedFile->Num(), LogFileSourceConstants::FileHeadSize);
+		if (FileHead.Num() < HeadSize)
+		{
+			FileHead.Reset();
+			FileHead.Append(MappedFile->GetData(), static_cast<int32>(HeadSize));
+		}
+	}
+	else
+	{
+		bFailedToOpen = !MappedFile.IsValid();
+		UE_LOG(LogSlate, Warning, TEXT("Could not map %s to list its lines."), *Filename);
+	}
+}
+
+bool FDynamicListLogFileSource::IsFileReplaced() const
+{
+	if (FileHead.Num() == 0)
+	{
+		return false;
+	}
+
+	// Read rather than mapped, the file at the path may not be the one mapped anymore
+	TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Filename, true));
+	if (!FileHandle.IsValid() || FileHandle->Size() < FileHead.Num())
+	{
+		// Missing or shorter files are told by their size
+		return false;
+	}
+
+	TArray<uint8> CurrentFileHead;
+	CurrentFileHead.SetNumUninitialized(FileHead.Num());
+	return FileHandle->Read(CurrentFileHead.GetData(), CurrentFileHead.Num()) && FMemory::Memcmp(CurrentFileHead.GetData(), FileHead.GetData(), FileHead.Num()) != 0;
+}
+
+int64 FDynamicListLogFileSource::GetMappedSize() const
+{
+	return MappedFile.IsValid() ? MappedFile->Num() : 0;
+}
+
+void FDynamicListLogFileSource::LaunchIndexingTask()
+{
+	const int64 MappedSize = GetMappedSize();
+	if (IndexingTask.IsValid() || FMath::Max(IndexedEnd, ScannedEnd) >= MappedSize)
+	{
+		return;
+	}
+
+	const int64 StartOffset = IndexedEnd;
+	const int64 ChunkEnd = FMath::Min(StartOffset + Settings.MaxBytesPerIndexingTask, MappedSize);
+	const int32 FirstLineIndex = NumLines;
+	const int32 LinesPerCheckpoint = Settings.LinesPerCheckpoint;
+
+	// A followed file may still be writing its last line
+	const bool bIndexUnterminatedLine = !Settings.bFollowAppends;
+
+	IndexingTask = Async(EAsyncExecution::ThreadPool, [this, File = MappedFile, StartOffset, ChunkEnd, FirstLineIndex, LinesPerCheckpoint, bIndexUnterminatedLine]()
+	{
+		FIndexedChunk Chunk;
+		Chunk.EndOffset = StartOffset;
+
+		const uint8* Data = File->GetData();
+		const int64 FileEnd = File->Num();
+
+		// Lines starting within the chunk are indexed whole, even when they end past it
+		int64 LineStart = StartOffset;
+		while (LineStart < ChunkEnd && FirstLineIndex + Chunk.NumLines < MAX_int32 && !bStopIndexing.load(std::memory_order_relaxed))
+		{
+			const uint8* LineEnd = static_cast<const uint8*>(memchr(Data + LineStart, '\n', FileEnd - LineStart));
+			if (LineEnd == nullptr && !bIndexUnterminatedLine)
+			{
+				LineStart = FileEnd;
+				break;
+			}
+
+			if ((FirstLineIndex + Chunk.NumLines) % LinesPerCheckpoint == 0)
+			{
+				Chunk.Checkpoints.Add(Chunk.EndOffset);
+			}
+			++Chunk.NumLines;
+
+			LineStart = LineEnd ? LineEnd - Data + 1 : FileEnd;
+			Chunk.EndOffset = LineStart;
+		}
+
+		Chunk.ScannedEnd = LineStart;
+		return Chunk;
+	});
+}
+
+void FDynamicListLogFileSource::ApplyIndexedChunk(const FIndexedChunk& Chunk)
+{
+	IndexedEnd = Chunk.EndOffset;
+	ScannedEnd = Chunk.ScannedEnd;
+
+	if (Chunk.NumLines > 0)
+	{
+		LineCheckpoints.Append(Chunk.Checkpoints);
+
+		const int32 FirstLineIndex = NumLines;
+		NumLines += Chunk.NumLines;
+		ItemsInsertedEvent.Broadcast(FirstLineIndex, Chunk.NumLines);
+	}
+}
+
+void FDynamicListLogFileSource::ResetIndex()
+{
+	if (IndexingTask.IsValid())
+	{
+		bStopIndexing = true;
+		IndexingTask.Wait();
+		IndexingTask.Reset();
+		bStopIndexing = false;
+	}
+
+	const int32 NumRemovedLines = NumLines;
+	++IndexEpoch;
+	FileHead.Reset();
+	LineCheckpoints.Reset();
+	NumLines = 0;
+	IndexedEnd = 0;
+	ScannedEnd = 0;
+	LastReadLineIndex = INDEX_NONE;
+
+	MappedFile.Reset();
+	MapFile();
+
+	if (NumRemovedLines > 0)
+	{
+		ItemsRemovedEvent.Broadcast(0, NumRemovedLines);
+	}
+	FileResetEvent.Broadcast();
+}
+
+int64 FDynamicListLogFileSource::FindLineStart(int32 LineIndex) const
+{
+	const int32 CheckpointIndex = LineIndex / Settings.LinesPerCheckpoint;
+	int32 CurrentLineIndex = CheckpointIndex * Settings.LinesPerCheckpoint;
+	int64 CurrentLineStart = LineCheckpoints[CheckpointIndex];
+
+	// Carry on from the line last read when it is on the way
+	if (LastReadLineIndex >= CurrentLineIndex && LastReadLineIndex <= LineIndex)
+	{
+		CurrentLineIndex = LastReadLineIndex;
+		CurrentLineStart = LastReadLineStart;
+	}
+
+	// Every line before the last indexed one is terminated
+	const uint8* Data = MappedFile->GetData();
+	while (CurrentLineIndex < LineIndex)
+	{
+		const uint8* LineEnd = static_cast<const uint8*>(memchr(Data + CurrentLineStart, '\n', IndexedEnd - CurrentLineStart));
+		CurrentLineStart = LineEnd - Data + 1;
+		++CurrentLineIndex;
+	}
+
+	LastReadLineIndex = LineIndex;
+	LastReadLineStart = CurrentLineStart;
+	return CurrentLineStart;
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "DynamicListDataSource.h"
+#include "DynamicListItemHandle.h"
+#include <atomic>
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** How a log file source indexes and follows its file */
+struct FDynamicListLogFileSettings
+{
+	/**
+	 * The offset of one line in this many is kept, the others are found by scanning from it when read.
+	 * Higher values make the index smaller and reading a line further from the previous one read slower.
+	 */
+	int32 LinesPerCheckpoint = 64;
+
+	/** Bytes of the file indexed by one background task, so that the lines show up as the file is indexed */
+	int64 MaxBytesPerIndexingTask = 16 * 1024 * 1024;
+
+	/** True to keep indexing the lines appended to the file while it is open. The last line is only listed once it is terminated. */
+	bool bFollowAppends = true;
+
+	/** Seconds between checks of the file size when following appends */
+	float FollowPollInterval = 0.5f;
+
+	/**
+	 * Length of every row along the scroll axis, for logs shown on a single line of fixed height.
+	 * Unset to measure the rows as they approach the view, the other lines are given the average length measured so far.
+	 */
+	TOptional<float> LineLength;
+};
+
+/**
+ * Data source listing the lines of a text file, e.g. a log, without loading it: the file is memory-mapped,
+ * and an index of where its lines start is built in the background, a task at a time, while the first lines are already listed.
+ * The items are handles made from the line numbers when the view asks for them, the source keeps nothing per line past a sparse index.
+ * The view estimates the lengths of the lines and only makes rows for those around the view, keeping a length per line by position
+ * rather than by item, so that opening a large file neither reads nor measures every line. Entries read their line with GetLine or GetLineText.
+ *
+ * Lines are added by the source as it indexes them and broadcast with OnItemsInserted, which the view observing the source follows.
+ * When the followed file shrank, or was replaced by another one, e.g. rotated by renaming it and starting a new file,
+ * every line is removed and the file indexed anew. Replacements are told by the start of the file changing.
+ * Truncating a followed file in place, e.g. copytruncate log rotation, is not supported: the lines are read from a mapping of the file,
+ * and reading a mapping past the end of a file truncated since faults on POSIX platforms.
+ * Lines are expected to be UTF-8, ended by '\n' or "\r\n". To be used from the game thread only.
+ */
+class FDynamicListLogFileSource : public IDynamicListDataSource<FDynamicListItemHandle>
+{
+public:
+	FDynamicListLogFileSource(const FString& InFilename, const FDynamicListLogFileSettings& InSettings = FDynamicListLogFileSettings());
+	virtual ~FDynamicListLogFileSource();
+
+	// IDynamicListDataSource interface
+	virtual int32 Num() const override { return NumLines; }
+	virtual FDynamicListItemHandle GetItem(int32 Index) const override;
+	virtual TOptional<int32> FindIndexOfItem(const FDynamicListItemHandle& Item) const override;
+	virtual TOptional<float> GetItemLengthHint(int32 Index) const override { return Settings.LineLength; }
+	// End of IDynamicListDataSource interface
+
+	/** @return The line standing for the given item, INDEX_NONE if it is not listed */
+	int32 GetLineIndex(const FDynamicListItemHandle& Item) const;
+
+	/**
+	 * @return The text of the given line as stored in the file, without its line terminator.
+	 * Points into the mapped file, which is mapped again as the file grows: do not keep it past the current frame.
+	 */
+	FUtf8StringView GetLine(int32 LineIndex) const;
+
+	/** @return The text of the given line, without its line terminator */
+	FString GetLineText(int32 LineIndex) const;
+
+	/** @return True if the file could be opened, an empty file counts */
+	bool IsOpen() const { return !bFailedToOpen; }
+
+	/** @return True while part of the mapped file is still to be indexed */
+	bool IsIndexing() const;
+
+	/** @return The fraction of the mapped file indexed so far, between 0 and 1 */
+	float GetIndexingProgress() const;
+
+	const FString& GetFilename() const { return Filename; }
+
+	/** Broadcast after OnItemsRemoved when the file shrank, e.g. because it was truncated or replaced, and its lines are indexed anew */
+	FSimpleMulticastDelegate& OnFileReset() { return FileResetEvent; }
+
+private:
+	/** A mapping of the whole file as of when it was made, shared with the indexing task reading it */
+	struct FMappedFile
+	{
+		const uint8* GetData() const;
+		int64 Num() const;
+
+		TUniquePtr<IMappedFileHandle> Handle;
+
+		/** Declared after the handle, so that it is unmapped before the handle is closed */
+		TUniquePtr<IMappedFileRegion> Region;
+	};
+
+	/** What an indexing task found, applied on the game thread */
+	struct FIndexedChunk
+	{
+		/** Offsets of the lines found whose number is a multiple of LinesPerCheckpoint */
+		TArray<int64> Checkpoints;
+
+		int32 NumLines = 0;
+
+		/** Where the next line starts */
+		int64 EndOffset = 0;
+
+		/** How far the file was scanned, past EndOffset when the line after the last one found is not terminated yet */
+		int64 ScannedEnd = 0;
+	};
+
+	bool Tick(float DeltaTime);
+
+	/** Map the file as it is now, replacing the previous mapping unless the file cannot be mapped */
+	void MapFile();
+
+	int64 GetMappedSize() const;
+
+	/** @return True if the start of the file at the path is not the start of the file indexed */
+	bool IsFileReplaced() const;
+
+	/** Start a task indexing from the last line indexed, unless one is running or there is nothing new to index */
+	void LaunchIndexingTask();
+
+	void ApplyIndexedChunk(const FIndexedChunk& Chunk);
+
+	/** Forget every line and index the file again from its start */
+	void ResetIndex();
+
+	/** @return The offset of the start of the given indexed line */
+	int64 FindLineStart(int32 LineIndex) const;
+
+	FString Filename;
+	FDynamicListLogFileSettings Settings;
+
+	TSharedPtr<FMappedFile, ESPMode::ThreadSafe> MappedFile;
+	bool bFailedToOpen = false;
+
+	/** The first bytes of the file indexed, see IsFileReplaced */
+	TArray<uint8> FileHead;
+
+	/**
+	 * Incremented every time the file is indexed anew, and part of the handles made for the lines,
+	 * so that the lines of the new file are new items to the view rather than taking the rows of the old lines.
+	 */
+	uint32 IndexEpoch = 0;
+
+	/** Offset of every LinesPerCheckpoint-th line */
+	TArray<int64> LineCheckpoints;
+	int32 NumLines = 0;
+
+	/** Where the first line not indexed yet starts */
+	int64 IndexedEnd = 0;
+
+	/** How far the file was scanned without finding the end of the line after the last one indexed */
+	int64 ScannedEnd = 0;
+
+	TFuture<FIndexedChunk> IndexingTask;
+
+	/** Tells the running indexing task to stop */
+	std::atomic<bool> bStopIndexing = false;
+
+	double LastFollowPollTime = 0.0;
+
+	/** The line last read and where it starts, so that reading lines in order does not scan from their checkpoint */
+	mutable int32 LastReadLineIndex = INDEX_NONE;
+	mutable int64 LastReadLineStart = 0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FSimpleMulticastDelegate FileResetEvent;
+};
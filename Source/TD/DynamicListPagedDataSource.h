@@ -0,0 +1,320 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicListDataSource.h"
+
+/** How a paged data source loads and keeps its pages */
+struct FDynamicListPagingSettings
+{
+	/** Number of items per page */
+	int32 PageSize = 100;
+
+	/** Number of pages past the items in view, in the direction the list scrolls, requested ahead of time */
+	int32 NumPrefetchPages = 2;
+
+	/**
+	 * Most pages kept in memory, loaded or holding placeholders.
+	 * Past it the least recently used pages away from the items in view are dropped, their items are made again when read.
+	 */
+	int32 MaxCachedPages = 32;
+
+	/** Length of placeholder rows along the scroll axis, so that entries not loaded yet are laid out without making them. Unset to measure placeholders. */
+	TOptional<float> PlaceholderLength;
+};
+
+/**
+ * Data source for lists backed by a paged query: the number of items is known up front, and pages of items are requested
+ * asynchronously around the items in view, further in the direction the list scrolls.
+ * Entries whose page has not arrived yet are stood for by placeholder items, swapped for the loaded items once it does.
+ * Requests for pages the list scrolled away from are cancelled.
+ * The view observing the source estimates the lengths of its items, so that it only reads the pages around the items in view.
+ *
+ * Items are kept by the source for as long as their page is cached, object items must be kept alive by whoever provides them.
+ * Placeholders must be distinct items, made for their index: a page dropped from the cache makes its placeholders again when read,
+ * so placeholders that are not made the same for the same index are new items to the view, e.g. their rows are made again.
+ * The view keeps the entries selected by index, so they stay selected as their pages are loaded or dropped.
+ */
+template <typename ItemType>
+class TDynamicListPagedDataSource : public IDynamicListDataSource<ItemType>
+{
+public:
+	/** Starts loading the given page, to be handed back through ProvidePage from within this call or later */
+	DECLARE_DELEGATE_ThreeParams( FOnRequestPage, int32 /*PageIndex*/, int32 /*FirstIndex*/, int32 /*NumItems*/ );
+
+	/** Tells that a requested page is no longer needed. If it is provided anyway, it is kept like any other page. */
+	DECLARE_DELEGATE_OneParam( FOnCancelPageRequest, int32 /*PageIndex*/ );
+
+	/** Makes the item standing for the entry at the given index until its page is loaded, distinct from every other item */
+	DECLARE_DELEGATE_RetVal_OneParam( ItemType, FOnMakePlaceholder, int32 /*Index*/ );
+
+	TDynamicListPagedDataSource(int32 InNumItems, const FDynamicListPagingSettings& InSettings, const FOnMakePlaceholder& InOnMakePlaceholder)
+		: Settings(InSettings)
+		, NumItems(FMath::Max(InNumItems, 0))
+		, OnMakePlaceholder(InOnMakePlaceholder)
+	{
+		Settings.PageSize = FMath::Max(Settings.PageSize, 1);
+		Settings.NumPrefetchPages = FMath::Max(Settings.NumPrefetchPages, 0);
+		Settings.MaxCachedPages = FMath::Max(Settings.MaxCachedPages, 1);
+
+		ensureMsgf(OnMakePlaceholder.IsBound(), TEXT("Paged data sources need placeholders for the items not loaded yet, every entry would otherwise be the same default item."));
+	}
+
+	FOnRequestPage OnRequestPage;
+	FOnCancelPageRequest OnCancelPageRequest;
+
+	// IDynamicListDataSource interface
+	virtual int32 Num() const override
+	{
+		return NumItems;
+	}
+
+	virtual ItemType GetItem(int32 Index) const override
+	{
+		const int32 PageIndex = Index / Settings.PageSize;
+		FPage& Page = Pages.FindOrAdd(PageIndex);
+		if (Page.Items.Num() == 0)
+		{
+			// First read of a page that is not loaded: make the placeholders standing for its entries
+			const int32 FirstIndex = GetFirstIndexOfPage(PageIndex);
+			const int32 NumPageItems = GetNumItemsInPage(PageIndex);
+			Page.Items.Reserve(NumPageItems);
+			for (int32 ItemIndex = FirstIndex; ItemIndex < FirstIndex + NumPageItems; ++ItemIndex)
+			{
+				Page.Items.Add(OnMakePlaceholder.IsBound() ? OnMakePlaceholder.Execute(ItemIndex) : ItemType());
+			}
+		}
+
+		Page.LastUsed = ++UseCount;
+		const ItemType Item = Page.Items[Index - GetFirstIndexOfPage(PageIndex)];
+
+		// Reading items outside the window, e.g. to measure them, must not grow the cache past its budget
+		TrimPages();
+		return Item;
+	}
+
+	virtual TOptional<int32> FindIndexOfItem(const ItemType& Item) const override
+	{
+		for (const TPair<int32, FPage>& PageEntry : Pages)
+		{
+			const int32 ItemIndexInPage = PageEntry.Value.Items.Find(Item);
+			if (ItemIndexInPage != INDEX_NONE)
+			{
+				return GetFirstIndexOfPage(PageEntry.Key) + ItemIndexInPage;
+			}
+		}
+
+		// The item may be in a page that was dropped from the cache, or not loaded yet: only the query could tell
+		return TOptional<int32>();
+	}
+
+	virtual TOptional<float> GetItemLengthHint(int32 Index) const override
+	{
+		const FPage* Page = Pages.Find(Index / Settings.PageSize);
+		return Page && Page->bLoaded ? TOptional<float>() : Settings.PlaceholderLength;
+	}
+
+	virtual void SetItemsInView(int32 FirstIndex, int32 LastIndex, bool bScrollingBackward) override
+	{
+		if (NumItems == 0)
+		{
+			return;
+		}
+
+		const int32 LastPageIndex = (NumItems - 1) / Settings.PageSize;
+		const int32 FirstPageInView = FMath::Clamp(FirstIndex / Settings.PageSize, 0, LastPageIndex);
+		const int32 LastPageInView = FMath::Clamp(LastIndex / Settings.PageSize, FirstPageInView, LastPageIndex);
+		FirstPageInWindow = bScrollingBackward ? FMath::Max(FirstPageInView - Settings.NumPrefetchPages, 0) : FirstPageInView;
+		LastPageInWindow = bScrollingBackward ? LastPageInView : FMath::Min(LastPageInView + Settings.NumPrefetchPages, LastPageIndex);
+
+		// Pages scrolled away from are not worth waiting for anymore
+		for (TPair<int32, FPage>& PageEntry : Pages)
+		{
+			if (PageEntry.Value.bRequested && !IsPageInWindow(PageEntry.Key))
+			{
+				PageEntry.Value.bRequested = false;
+				OnCancelPageRequest.ExecuteIfBound(PageEntry.Key);
+			}
+		}
+
+		// Pages in view first, then the prefetched ones nearest first
+		for (int32 PageIndex = FirstPageInView; PageIndex <= LastPageInView; ++PageIndex)
+		{
+			RequestPage(PageIndex);
+		}
+		if (bScrollingBackward)
+		{
+			for (int32 PageIndex = FirstPageInView - 1; PageIndex >= FirstPageInWindow; --PageIndex)
+			{
+				RequestPage(PageIndex);
+			}
+		}
+		else
+		{
+			for (int32 PageIndex = LastPageInView + 1; PageIndex <= LastPageInWindow; ++PageIndex)
+			{
+				RequestPage(PageIndex);
+			}
+		}
+
+		TrimPages();
+	}
+	// End of IDynamicListDataSource interface
+
+	/**
+	 * Hand over the items of a page, in response to OnRequestPage or not.
+	 * The list is told to swap the page's placeholders for them.
+	 */
+	void ProvidePage(int32 PageIndex, TArray<ItemType>&& InItems)
+	{
+		const int32 NumPageItems = GetNumItemsInPage(PageIndex);
+		if (!ensureMsgf(PageIndex >= 0 && NumPageItems > 0 && InItems.Num() == NumPageItems, TEXT("Page %d of %d items was provided with %d items."), PageIndex, NumPageItems, InItems.Num()))
+		{
+			return;
+		}
+
+		FPage& Page = Pages.FindOrAdd(PageIndex);
+		Page.Items = MoveTemp(InItems);
+		Page.bLoaded = true;
+		Page.bRequested = false;
+		Page.LastUsed = ++UseCount;
+
+		this->ItemsRefreshedEvent.Broadcast(GetFirstIndexOfPage(PageIndex), NumPageItems);
+
+		TrimPages();
+	}
+
+	/**
+	 * Change the number of items, e.g. once the query counted them. Pages past the new end are dropped.
+	 * The list must be told as for any items source: NotifyItemsInserted, NotifyItemsRemoved or RequestListRefresh.
+	 */
+	void SetNumItems(int32 InNumItems)
+	{
+		// The pages that were or are now the last one may have changed size, drop them along with the ones past them
+		const int32 NumUnchangedPages = FMath::DivideAndRoundDown(FMath::Min(NumItems, FMath::Max(InNumItems, 0)), Settings.PageSize);
+		NumItems = FMath::Max(InNumItems, 0);
+
+		for (auto PageIt = Pages.CreateIterator(); PageIt; ++PageIt)
+		{
+			if (PageIt.Key() >= NumUnchangedPages)
+			{
+				CancelPageRequest(PageIt.Key(), PageIt.Value());
+				PageIt.RemoveCurrent();
+			}
+		}
+	}
+
+	/**
+	 * Drop every page, e.g. when the query changed, cancelling the pending requests.
+	 * The list must be told with RequestListRefresh.
+	 */
+	void Reset()
+	{
+		for (TPair<int32, FPage>& PageEntry : Pages)
+		{
+			CancelPageRequest(PageEntry.Key, PageEntry.Value);
+		}
+		Pages.Reset();
+	}
+
+	/** @return True if the items of the given page were provided and are still cached */
+	bool IsPageLoaded(int32 PageIndex) const
+	{
+		const FPage* Page = Pages.Find(PageIndex);
+		return Page && Page->bLoaded;
+	}
+
+	const FDynamicListPagingSettings& GetSettings() const { return Settings; }
+
+private:
+	struct FPage
+	{
+		/** The loaded items, or the placeholders once read while not loaded. Empty until either. */
+		TArray<ItemType> Items;
+
+		bool bLoaded = false;
+
+		/** True while a request for the page is pending */
+		bool bRequested = false;
+
+		/** When the page was last read, for dropping the least recently used pages */
+		uint64 LastUsed = 0;
+	};
+
+	int32 GetFirstIndexOfPage(int32 PageIndex) const
+	{
+		return PageIndex * Settings.PageSize;
+	}
+
+	int32 GetNumItemsInPage(int32 PageIndex) const
+	{
+		return FMath::Clamp(NumItems - GetFirstIndexOfPage(PageIndex), 0, Settings.PageSize);
+	}
+
+	bool IsPageInWindow(int32 PageIndex) const
+	{
+		return PageIndex >= FirstPageInWindow && PageIndex <= LastPageInWindow;
+	}
+
+	void RequestPage(int32 PageIndex)
+	{
+		FPage& Page = Pages.FindOrAdd(PageIndex);
+		Page.LastUsed = ++UseCount;
+		if (!Page.bLoaded && !Page.bRequested)
+		{
+			Page.bRequested = true;
+			OnRequestPage.ExecuteIfBound(PageIndex, GetFirstIndexOfPage(PageIndex), GetNumItemsInPage(PageIndex));
+		}
+	}
+
+	void CancelPageRequest(int32 PageIndex, FPage& Page) const
+	{
+		if (Page.bRequested)
+		{
+			Page.bRequested = false;
+			OnCancelPageRequest.ExecuteIfBound(PageIndex);
+		}
+	}
+
+	/** Drop the least recently used pages away from the items in view until the cache fits in its budget */
+	void TrimPages() const
+	{
+		while (Pages.Num() > Settings.MaxCachedPages)
+		{
+			int32 OldestPageIndex = INDEX_NONE;
+			uint64 OldestUse = MAX_uint64;
+			for (const TPair<int32, FPage>& PageEntry : Pages)
+			{
+				if (!IsPageInWindow(PageEntry.Key) && PageEntry.Value.LastUsed < OldestUse)
+				{
+					OldestPageIndex = PageEntry.Key;
+					OldestUse = PageEntry.Value.LastUsed;
+				}
+			}
+
+			if (OldestPageIndex == INDEX_NONE)
+			{
+				// Everything left is in view or prefetched
+				break;
+			}
+
+			CancelPageRequest(OldestPageIndex, Pages[OldestPageIndex]);
+			Pages.Remove(OldestPageIndex);
+		}
+	}
+
+	FDynamicListPagingSettings Settings;
+
+	int32 NumItems = 0;
+
+	FOnMakePlaceholder OnMakePlaceholder;
+
+	/** Cached pages by index, placeholders are made on first read so that they stay the same items until their page is loaded */
+	mutable TMap<int32, FPage> Pages;
+
+	/** Pages in view or prefetched, as of the last SetItemsInView. They are never dropped. */
+	int32 FirstPageInWindow = 0;
+	int32 LastPageInWindow = INDEX_NONE;
+
+	/** Incremented on every page read, orders the pages by last use */
+	mutable uint64 UseCount = 0;
+};
@@ -0,0 +1,198 @@
+#include "DynamicListSelectionRanges.h"
+
+void FDynamicListSelectionRanges::Reset()
+{
+	Ranges.Reset();
+	NumIndices = 0;
+}
+
+void FDynamicListSelectionRanges::Add(int32 First, int32 Last)
+{
+	if (First > Last)
+	{
+		return;
+	}
+
+	// Swallow every range overlapping or touching the new one
+	const int32 StartRangeIndex = LowerBound(First - 1);
+	int32 EndRangeIndex = StartRangeIndex;
+	FInt32Interval MergedRange(First, Last);
+	while (EndRangeIndex < Ranges.Num() && Ranges[EndRangeIndex].Min <= Last + 1)
+	{
+		const FInt32Interval& Range = Ranges[EndRangeIndex];
+		MergedRange.Min = FMath::Min(MergedRange.Min, Range.Min);
+		MergedRange.Max = FMath::Max(MergedRange.Max, Range.Max);
+		NumIndices -= Range.Max - Range.Min + 1;
+		++EndRangeIndex;
+	}
+
+	Ranges.RemoveAt(StartRangeIndex, EndRangeIndex - StartRangeIndex);
+	Ranges.Insert(MergedRange, StartRangeIndex);
+	NumIndices += MergedRange.Max - MergedRange.Min + 1;
+}
+
+void FDynamicListSelectionRanges::Remove(int32 First, int32 Last)
+{
+	int32 RangeIndex = LowerBound(First);
+	while (First <= Last && RangeIndex < Ranges.Num() && Ranges[RangeIndex].Min <= Last)
+	{
+		FInt32Interval& Range = Ranges[RangeIndex];
+		NumIndices -= FMath::Min(Range.Max, Last) - FMath::Max(Range.Min, First) + 1;
+
+		if (Range.Min < First && Range.Max > Last)
+		{
+			// Punch a hole in the middle of the range
+			const FInt32Interval TailRange(Last + 1, Range.Max);
+			Range.Max = First - 1;
+			Ranges.Insert(TailRange, RangeIndex + 1);
+			return;
+		}
+		else if (Range.Min < First)
+		{
+			Range.Max = First - 1;
+			++RangeIndex;
+		}
+		else if (Range.Max > Last)
+		{
+			Range.Min = Last + 1;
+			return;
+		}
+		else
+		{
+			Ranges.RemoveAt(RangeIndex);
+		}
+	}
+}
+
+bool FDynamicListSelectionRanges::Contains(int32 Index) const
+{
+	const int32 RangeIndex = LowerBound(Index);
+	return RangeIndex < Ranges.Num() && Ranges[RangeIndex].Min <= Index;
+}
+
+void FDynamicListSelectionRanges::Insert(int32 Index, int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	int32 RangeIndex = LowerBound(Index);
+	if (RangeIndex < Ranges.Num() && Ranges[RangeIndex].Min < Index)
+	{
+		// The inserted items split the range they land in
+		const FInt32Interval TailRange(Index + Count, Ranges[RangeIndex].Max + Count);
+		Ranges[RangeIndex].Max = Index - 1;
+		Ranges.Insert(TailRange, RangeIndex + 1);
+		RangeIndex += 2;
+	}
+
+	for (; RangeIndex < Ranges.Num(); ++RangeIndex)
+	{
+		Ranges[RangeIndex].Min += Count;
+		Ranges[RangeIndex].Max += Count;
+	}
+}
+
+void FDynamicListSelectionRanges::RemoveAt(int32 Index, int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	Remove(Index, Index + Count - 1);
+
+	// Nothing covers the removed items anymore, so every range from here on comes after them
+	const int32 FirstShiftedRangeIndex = LowerBound(Index);
+	for (int32 RangeIndex = FirstShiftedRangeIndex; RangeIndex < Ranges.Num(); ++RangeIndex)
+	{
+		Ranges[RangeIndex].Min -= Count;
+		Ranges[RangeIndex].Max -= Count;
+	}
+
+	// The ranges on both sides of the removed items may now touch
+	if (FirstShiftedRangeIndex > 0 && FirstShiftedRangeIndex < Ranges.Num() && Ranges[FirstShiftedRangeIndex - 1].Max + 1 == Ranges[FirstShiftedRangeIndex].Min)
+	{
+		Ranges[FirstShiftedRangeIndex - 1].Max = Ranges[FirstShiftedRangeIndex].Max;
+		Ranges.RemoveAt(FirstShiftedRangeIndex);
+	}
+}
+
+void FDynamicListSelectionRanges::Move(int32 FromIndex, int32 Count, int32 ToIndex)
+{
+	if (Count <= 0 || FromIndex == ToIndex)
+	{
+		return;
+	}
+
+	// The parts of the moved items in the set, relative to the first moved item
+	TArray<FInt32Interval, TInlineAllocator<4>> MovedRanges;
+	const int32 LastIndex = FromIndex + Count - 1;
+	for (int32 RangeIndex = LowerBound(FromIndex); RangeIndex < Ranges.Num() && Ranges[RangeIndex].Min <= LastIndex; ++RangeIndex)
+	{
+		const FInt32Interval& Range = Ranges[RangeIndex];
+		MovedRanges.Add(FInt32Interval(FMath::Max(Range.Min, FromIndex) - FromIndex, FMath::Min(Range.Max, LastIndex) - FromIndex));
+	}
+
+	RemoveAt(FromIndex, Count);
+	Insert(ToIndex, Count);
+
+	for (const FInt32Interval& MovedRange : MovedRanges)
+	{
+		Add(ToIndex + MovedRange.Min, ToIndex + MovedRange.Max);
+	}
+}
+
+void FDynamicListSelectionRanges::Remap(TArrayView<const int32> PreviousIndices)
+{
+	if (IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FInt32Interval> NewRanges;
+	int32 NewNumIndices = 0;
+	for (int32 Index = 0; Index < PreviousIndices.Num(); ++Index)
+	{
+		if (PreviousIndices[Index] != INDEX_NONE && Contains(PreviousIndices[Index]))
+		{
+			if (NewRanges.Num() > 0 && NewRanges.Last().Max == Index - 1)
+			{
+				NewRanges.Last().Max = Index;
+			}
+			else
+			{
+				NewRanges.Add(FInt32Interval(Index, Index));
+			}
+			++NewNumIndices;
+		}
+	}
+
+	Ranges = MoveTemp(NewRanges);
+	NumIndices = NewNumIndices;
+}
+
+void FDynamicListSelectionRanges::Truncate(int32 NumItems)
+{
+	Remove(NumItems, MAX_int32);
+}
+
+int32 FDynamicListSelectionRanges::LowerBound(int32 Index) const
+{
+	int32 Low = 0;
+	int32 High = Ranges.Num();
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if (Ranges[Mid].Max < Index)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Interval.h"
+
+/**
+ * Set of item indices stored as sorted, disjoint and non-adjacent ranges,
+ * so that selecting every item or a run of thousands of them costs a single range.
+ * Contains is O(log R) where R is the number of ranges; adding, removing or shifting ranges is O(log R) plus moving the ranges after them.
+ */
+class FDynamicListSelectionRanges
+{
+public:
+	void Reset();
+
+	/** Add the indices from First to Last included. */
+	void Add(int32 First, int32 Last);
+
+	/** Remove the indices from First to Last included. */
+	void Remove(int32 First, int32 Last);
+
+	/** @return True if the given index is in the set. */
+	bool Contains(int32 Index) const;
+
+	/** @return The number of indices in the set. */
+	int32 Num() const { return NumIndices; }
+
+	bool IsEmpty() const { return NumIndices == 0; }
+
+	/** Shift the indices to make room for items inserted at the given index, the inserted items are not in the set. */
+	void Insert(int32 Index, int32 Count);
+
+	/** Remove the indices of items removed at the given index and shift the following ones back. */
+	void RemoveAt(int32 Index, int32 Count);
+
+	/** Follow consecutive items moved so that the first of them ends up at ToIndex. */
+	void Move(int32 FromIndex, int32 Count, int32 ToIndex);
+
+	/**
+	 * Follow items that changed places as a whole.
+	 * PreviousIndices holds, for every item now present, its previous index or INDEX_NONE when it is new.
+	 */
+	void Remap(TArrayView<const int32> PreviousIndices);
+
+	/** Remove every index past the given number of items. */
+	void Truncate(int32 NumItems);
+
+	/** @return The ranges in ascending order. */
+	TArrayView<const FInt32Interval> GetRanges() const { return Ranges; }
+
+private:
+	/** @return The index of the first range ending at or after the given index, Ranges.Num() if there is none. */
+	int32 LowerBound(int32 Index) const;
+
+	/** Sorted, disjoint and non-adjacent ranges of indices, both ends included. */
+	TArray<FInt32Interval> Ranges;
+
+	/** Number of indices covered by the ranges. */
+	int32 NumIndices = 0;
+};
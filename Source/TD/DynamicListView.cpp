@@ -90,30 +90,297 @@ void UDynamicListView::AddItem(UObject* Item)
 		return;
 	}
 
-	if (ListItems.Contains(Item))
+	if (GetIndexForItem(Item) != INDEX_NONE)
 	{
 		FFrame::KismetExecutionMessage(TEXT("Cannot add duplicate item into ListView."), ELogVerbosity::Warning, "DuplicateListViewItem");
 		return;
 	}
 
-	ListItems.Add(Item);
+	const int32 NewItemIndex = ListItems.Add(Item);
 
 	const TArray<UObject*> Added = { Item };
 	const TArray<UObject*> Removed;
 	OnItemsChanged(Added, Removed);
 
-	RequestRefresh();
+	// Only the appended entry needs measuring
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsInserted(NewItemIndex, 1);
+	}
+	EnforceMaxNumItems();
 }
 
 void UDynamicListView::RemoveItem(UObject* Item)
 {
-	ListItems.Remove(Item);
+	const int32 ItemIndex = GetIndexForItem(Item);
+	if (ItemIndex != INDEX_NONE)
+	{
+		RemoveItems(ItemIndex, 1);
+	}
+}
+
+void UDynamicListView::InsertItems(int32 Index, const TArray<UObject*>& Items)
+{
+	if (Index < 0 || Index > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot insert items into ListView at index %d, it only has %d items."), Index, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	TArray<UObject*> Added;
+	Added.Reserve(Items.Num());
+	TSet<UObject*> AddedItemSet;
+	AddedItemSet.Reserve(Items.Num());
+	for (UObject* Item : Items)
+	{
+		if (Item == nullptr)
+		{
+			FFrame::KismetExecutionMessage(TEXT("Cannot add null item into ListView."), ELogVerbosity::Warning, "NullListViewItem");
+			continue;
+		}
+
+		bool bDuplicate = GetIndexForItem(Item) != INDEX_NONE;
+		if (!bDuplicate)
+		{
+			AddedItemSet.Add(Item, &bDuplicate);
+		}
+
+		if (bDuplicate)
+		{
+			FFrame::KismetExecutionMessage(TEXT("Cannot add duplicate item into ListView."), ELogVerbosity::Warning, "DuplicateListViewItem");
+		}
+		else
+		{
+			Added.Add(Item);
+		}
+	}
+
+	if (Added.Num() == 0)
+	{
+		return;
+	}
+
+	UObject* PreviousFirstItem = GetItemAt(0);
+	ListItems.InsertDefaulted(Index, Added.Num());
+	for (int32 AddedIndex = 0; AddedIndex < Added.Num(); ++AddedIndex)
+	{
+		ListItems[Index + AddedIndex] = Added[AddedIndex];
+	}
+
+	OnItemsChanged(Added, TArray<UObject*>());
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsInserted(Index, Added.Num());
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+	EnforceMaxNumItems();
+}
+
+void UDynamicListView::RemoveItems(int32 Index, int32 NumItems)
+{
+	if (Index < 0 || NumItems < 0 || Index + NumItems > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot remove %d items from ListView at index %d, it only has %d items."), NumItems, Index, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems == 0)
+	{
+		return;
+	}
+
+	UObject* PreviousFirstItem = GetItemAt(0);
+	TArray<UObject*> Removed;
+	Removed.Reserve(NumItems);
+	for (int32 ItemIndex = Index; ItemIndex < Index + NumItems; ++ItemIndex)
+	{
+		Removed.Add(ListItems[ItemIndex]);
+	}
+	ListItems.RemoveAt(Index, NumItems);
+
+	OnItemsChanged(TArray<UObject*>(), Removed);
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsRemoved(Index, NumItems);
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+}
+
+void UDynamicListView::MoveItems(int32 FromIndex, int32 NumItems, int32 ToIndex)
+{
+	if (FromIndex < 0 || ToIndex < 0 || NumItems < 0 || FMath::Max(FromIndex, ToIndex) + NumItems > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot move %d items of ListView from index %d to index %d, it only has %d items."), NumItems, FromIndex, ToIndex, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	if (NumItems == 0 || FromIndex == ToIndex)
+	{
+		return;
+	}
+
+	UObject* PreviousFirstItem = GetItemAt(0);
+	const TArray<TObjectPtr<UObject>> MovedItems(ListItems.GetData() + FromIndex, NumItems);
+	ListItems.RemoveAt(FromIndex, NumItems);
+	ListItems.Insert(MovedItems, ToIndex);
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsMoved(FromIndex, NumItems, ToIndex);
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+}
+
+void UDynamicListView::ReplaceItems(int32 Index, const TArray<UObject*>& Items)
+{
+	if (Index < 0 || Index + Items.Num() > ListItems.Num())
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("Cannot replace %d items of ListView at index %d, it only has %d items."), Items.Num(), Index, ListItems.Num()), ELogVerbosity::Warning, "InvalidListViewIndex");
+		return;
+	}
+
+	TSet<UObject*> NewItemSet;
+	NewItemSet.Reserve(Items.Num());
+	for (int32 NewItemIndex = 0; NewItemIndex < Items.Num(); ++NewItemIndex)
+	{
+		UObject* Item = Items[NewItemIndex];
+		if (Item == nullptr)
+		{
+			FFrame::KismetExecutionMessage(TEXT("Cannot add null item into ListView."), ELogVerbosity::Warning, "NullListViewItem");
+			return;
+		}
+
+		// An item may only stay at its own place or take the place of another replaced item
+		const int32 ExistingIndex = GetIndexForItem(Item);
+		const bool bReplacedItem = ExistingIndex >= Index && ExistingIndex < Index + Items.Num();
+		bool bDuplicateNewItem = false;
+		NewItemSet.Add(Item, &bDuplicateNewItem);
+		if ((ExistingIndex != INDEX_NONE && !bReplacedItem) || bDuplicateNewItem)
+		{
+			FFrame::KismetExecutionMessage(TEXT("Cannot add duplicate item into ListView."), ELogVerbosity::Warning, "DuplicateListViewItem");
+			return;
+		}
+	}
+
+	if (Items.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<UObject*> Removed;
+	Removed.Reserve(Items.Num());
+	for (int32 NewItemIndex = 0; NewItemIndex < Items.Num(); ++NewItemIndex)
+	{
+		Removed.Add(ListItems[Index + NewItemIndex]);
+		ListItems[Index + NewItemIndex] = Items[NewItemIndex];
+	}
+
+	OnItemsChanged(Items, Removed);
+
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsReplaced(Index, Items.Num());
+	}
+}
+
+void UDynamicListView::UpdateListItems(TArray<TObjectPtr<UObject>>&& NewListItems)
+{
+	TMap<UObject*, int32> PreviousIndexOfItem;
+	PreviousIndexOfItem.Reserve(ListItems.Num());
+	for (int32 ItemIndex = 0; ItemIndex < ListItems.Num(); ++ItemIndex)
+	{
+		PreviousIndexOfItem.Add(ListItems[ItemIndex], ItemIndex);
+	}
+
+	// Compact the new items in place, noting where each of them used to be
+	TArray<int32> PreviousIndices;
+	PreviousIndices.Reserve(NewListItems.Num());
+	TBitArray<> KeptItems(false, ListItems.Num());
+	TSet<UObject*> AddedItemSet;
+	TArray<UObject*> Added;
+	int32 NumNewItems = 0;
+	for (int32 NewItemIndex = 0; NewItemIndex < NewListItems.Num(); ++NewItemIndex)
+	{
+		UObject* Item = NewListItems[NewItemIndex];
+		if (Item == nullptr)
+		{
+			continue;
+		}
+
+		bool bDuplicate = false;
+		const int32* PreviousIndex = PreviousIndexOfItem.Find(Item);
+		if (PreviousIndex)
+		{
+			bDuplicate = KeptItems[*PreviousIndex];
+			KeptItems[*PreviousIndex] = true;
+		}
+		else
+		{
+			AddedItemSet.Add(Item, &bDuplicate);
+			if (!bDuplicate)
+			{
+				Added.Add(Item);
+			}
+		}
+
+		if (!bDuplicate)
+		{
+			PreviousIndices.Add(PreviousIndex ? *PreviousIndex : INDEX_NONE);
+			NewListItems[NumNewItems++] = Item;
+		}
+	}
+	NewListItems.SetNum(NumNewItems);
+
+	TArray<UObject*> Removed;
+	for (int32 ItemIndex = 0; ItemIndex < ListItems.Num(); ++ItemIndex)
+	{
+		if (!KeptItems[ItemIndex])
+		{
+			Removed.Add(ListItems[ItemIndex]);
+		}
+	}
+
+	UObject* PreviousFirstItem = GetItemAt(0);
+	ListItems = MoveTemp(NewListItems);
 
-	const TArray<UObject*> Added;
-	const TArray<UObject*> Removed = { Item };
 	OnItemsChanged(Added, Removed);
 
-	RequestRefresh();
+	if (MyListView.IsValid())
+	{
+		MyListView->NotifyItemsReordered(PreviousIndices);
+	}
+	InvalidateFirstEntryLengths(PreviousFirstItem);
+	EnforceMaxNumItems();
+}
+
+void UDynamicListView::InvalidateFirstEntryLengths(const UObject* PreviousFirstItem)
+{
+	if (EntrySpacing == 0.f || ListItems.Num() == 0 || ListItems[0] == PreviousFirstItem)
+	{
+		return;
+	}
+
+	InvalidateItemLengthRange(0, 1);
+
+	const int32 PreviousFirstIndex = PreviousFirstItem ? GetIndexForItem(PreviousFirstItem) : INDEX_NONE;
+	if (PreviousFirstIndex != INDEX_NONE)
+	{
+		InvalidateItemLengthRange(PreviousFirstIndex, 1);
+	}
+}
+
+void UDynamicListView::EnforceMaxNumItems()
+{
+	if (MaxNumItems <= 0 || ListItems.Num() <= MaxNumItems)
+	{
+		return;
+	}
+
+	// Removing the first items moves all the others, so a batch of them is removed at once rather than one per item added
+	const int32 RemovalBatchSize = FMath::Max(MaxNumItems / 16, 1);
+	RemoveItems(0, FMath::Min(FMath::Max(ListItems.Num() - MaxNumItems, RemovalBatchSize), ListItems.Num()));
 }
 
 UObject* UDynamicListView::GetItemAt(int32 Index) const
@@ -128,6 +395,11 @@ int32 UDynamicListView::GetNumItems() const
 
 int32 UDynamicListView::GetIndexForItem(const UObject* Item) const
 {
+	// The list widget keeps an item to index map in sync with ListItems, only search them before it is constructed
+	if (MyListView.IsValid())
+	{
+		return MyListView->GetIndexOfItem(const_cast<UObject*>(Item));
+	}
 	return ListItems.IndexOfByKey(Item);
 }
 
@@ -143,6 +415,12 @@ void UDynamicListView::ClearListItems()
 	RequestRefresh();
 }
 
+void UDynamicListView::SetMaxNumItems(int32 InMaxNumItems)
+{
+	MaxNumItems = FMath::Max(InMaxNumItems, 0);
+	EnforceMaxNumItems();
+}
+
 void UDynamicListView::SetSelectionMode(TEnumAsByte<ESelectionMode::Type> InSelectionMode)
 {
 	SelectionMode = InSelectionMode;
@@ -167,8 +445,27 @@ UObject* UDynamicListView::BP_GetSelectedItem() const
 	return GetSelectedItem();
 }
 
+bool UDynamicListView::GetEntryLengthForItem_Implementation(UObject* Item, float& OutLength) const
+{
+	return false;
+}
+
+TOptional<float> UDynamicListView::HandleGetItemLength(UObject* Item) const
+{
+	float EntryLength = 0.f;
+	if (!GetEntryLengthForItem(Item, EntryLength))
+	{
+		return TOptional<float>();
+	}
+
+	// Add the spacing measured entries get through their padding
+	const FMargin EntryPadding = GetDesiredEntryPadding(Item);
+	return EntryLength + (Orientation == EOrientation::Orient_Horizontal ? EntryPadding.GetTotalSpaceAlong<Orient_Horizontal>() : EntryPadding.GetTotalSpaceAlong<Orient_Vertical>());
+}
+
 void UDynamicListView::HandleOnEntryInitializedInternal(UObject* Item, const TSharedRef<ITableRow>& TableRow)
 {
+	HandleEntryInitialized(Item, TableRow);
 	BP_OnEntryInitialized.Broadcast(Item, GetEntryWidgetFromItem(Item));
 }
 
@@ -208,6 +505,22 @@ void UDynamicListView::ScrollIndexIntoView(int32 Index)
 	BP_ScrollItemIntoView(GetItemAt(Index));
 }
 
+void UDynamicListView::ScrollIndexIntoViewAligned(int32 Index, EDescendantScrollDestination Alignment, float Padding)
+{
+	if (UObject* Item = GetItemAt(Index))
+	{
+		RequestScrollItemIntoView(Item, Alignment, Padding);
+	}
+}
+
+void UDynamicListView::BP_InvalidateItemLength(UObject* Item)
+{
+	if (Item)
+	{
+		InvalidateItemLength(Item);
+	}
+}
+
 void UDynamicListView::BP_CancelScrollIntoView()
 {
 	if (MyListView.IsValid())
@@ -368,10 +681,12 @@ void UDynamicListView::OnItemScrolledIntoViewInternal(UObject* ListItem, UUserWi
 	BP_OnItemScrolledIntoView.Broadcast(ListItem, &EntryWidget);
 }
 
-void UDynamicListView::OnListViewScrolledInternal(float ItemOffset, float DistanceRemaining)
+void UDynamicListView::OnListViewScrolledInternal(double ItemOffset, float DistanceRemaining)
 {
 	ITypedUMGDynamicListView::OnListViewScrolledInternal(ItemOffset, DistanceRemaining);
-	BP_OnListViewScrolled.Broadcast(ItemOffset, DistanceRemaining);
+
+	// The Blueprint event is shared with the engine list views and only takes floats
+	BP_OnListViewScrolled.Broadcast((float)ItemOffset, DistanceRemaining);
 }
 
 /////////////////////////////////////////////////////
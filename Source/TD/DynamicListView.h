@@ -25,23 +25,32 @@ public:
 
 	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 	
-	/** Set the list of items to display within this listview */
+	/**
+	 * Set the list of items to display within this listview.
+	 * Items that were already in the list keep their entry widget, measured length and selection; only the new ones are measured.
+	 */
 	template <typename ItemObjectT, typename AllocatorType = FDefaultAllocator>
 	void SetListItems(const TArray<ItemObjectT, AllocatorType>& InListItems)
 	{
-		ClearListItems();
-		ListItems.Reserve(InListItems.Num());
+		TArray<TObjectPtr<UObject>> NewListItems;
+		NewListItems.Reserve(InListItems.Num());
 		for (const ItemObjectT ListItem : InListItems)
 		{
-			if (ListItem != nullptr)
-			{
-				ListItems.Add(ListItem);
-			}
+			NewListItems.Add(ListItem);
 		}
 
-		OnItemsChanged(ListItems, TArray<UObject*>());
+		UpdateListItems(MoveTemp(NewListItems));
+	}
+
+	/** Set the list of items to display within this listview, taking the given array over rather than copying it */
+	void SetListItems(TArray<TObjectPtr<UObject>>&& InListItems)
+	{
+		UpdateListItems(MoveTemp(InListItems));
+	}
 
-		RequestRefresh();
+	void SetListItems(TArray<UObject*>&& InListItems)
+	{
+		UpdateListItems(TArray<TObjectPtr<UObject>>(MoveTemp(InListItems)));
 	}
 
 	ESelectionMode::Type GetSelectionMode() const { return SelectionMode; }
@@ -76,6 +85,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = ListView)
 	void RemoveItem(UObject* Item);
 
+	/**
+	 * Inserts items into the list before the item at the given index.
+	 * Only the new entries are measured, and the selection and the entries in view are kept.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void InsertItems(int32 Index, const TArray<UObject*>& Items);
+
+	/** Removes the given number of items from the list, starting at the given index. The remaining entries keep their measured lengths. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void RemoveItems(int32 Index, int32 NumItems);
+
+	/** Moves the given number of consecutive items so that the first of them ends up at ToIndex. The moved entries keep their measured lengths. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void MoveItems(int32 FromIndex, int32 NumItems, int32 ToIndex);
+
+	/** Replaces the items starting at the given index by the given ones. Only the new entries are measured. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void ReplaceItems(int32 Index, const TArray<UObject*>& Items);
+
 	/** Returns the item at the given index */
 	UFUNCTION(BlueprintCallable, Category = ListView)
 	UObject* GetItemAt(int32 Index) const;
@@ -92,6 +120,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = ListView)
 	void ClearListItems();
 
+	/** Sets the most items the list keeps, 0 for no limit. The first items past it are removed right away. */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void SetMaxNumItems(int32 InMaxNumItems);
+
 	/** Sets the new selection mode, preserving the current selection where possible. */
 	UFUNCTION(BlueprintCallable, Category = ListView)
 	void SetSelectionMode(TEnumAsByte<ESelectionMode::Type> SelectionMode);
@@ -104,6 +136,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = ListView)
 	void ScrollIndexIntoView(int32 Index);
 
+	/**
+	 * Requests that the item at the given index is scrolled to the given place in the view, in a single scroll.
+	 * IntoView scrolls as little as possible to show the whole entry, the others align it with the start, center or end of the view.
+	 * Padding is the space left between the entry and the edge of the view it is brought next to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListView)
+	void ScrollIndexIntoViewAligned(int32 Index, EDescendantScrollDestination Alignment = EDescendantScrollDestination::IntoView, float Padding = 0.f);
+
 	/** Sets the item at the given index as the sole selected item. */
 	UFUNCTION(BlueprintCallable, Category = ListView)
 	void SetSelectedIndex(int32 Index);
@@ -115,6 +155,27 @@ public:
 protected:
 	virtual void OnItemsChanged(const TArray<UObject*>& AddedItems, const TArray<UObject*>& RemovedItems);
 
+	/**
+	 * Gives the length of the entry for the given item along the scroll axis, entry spacing excluded, when it is known from the item alone.
+	 * Only called when bGetEntryLengthsFromItems is set. Entries this returns true for are never instantiated just to be measured.
+	 *
+	 * @return True if OutLength was set, false to measure the entry widget instead.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = ListView)
+	bool GetEntryLengthForItem(UObject* Item, float& OutLength) const;
+	virtual bool GetEntryLengthForItem_Implementation(UObject* Item, float& OutLength) const;
+
+	TOptional<float> HandleGetItemLength(UObject* Item) const;
+
+	/** Make the given items the list items, diffing them against the current ones. Null and duplicate items are dropped. */
+	void UpdateListItems(TArray<TObjectPtr<UObject>>&& NewListItems);
+
+	/** The first entry is the only one without spacing: measure again the entries that became or stopped being the first one */
+	void InvalidateFirstEntryLengths(const UObject* PreviousFirstItem);
+
+	/** Remove the first items past MaxNumItems */
+	void EnforceMaxNumItems();
+
 	UFUNCTION()
 	void OnListItemEndPlayed(AActor* Item, EEndPlayReason::Type EndPlayReason);
 
@@ -136,7 +197,7 @@ protected:
 	virtual void OnItemDoubleClickedInternal(UObject* Item) override;
 	virtual void OnSelectionChangedInternal(UObject* FirstSelectedItem) override;
 	virtual void OnItemScrolledIntoViewInternal(UObject* Item, UUserWidget& EntryWidget) override;
-	virtual void OnListViewScrolledInternal(float ItemOffset, float DistanceRemaining) override;
+	virtual void OnListViewScrolledInternal(double ItemOffset, float DistanceRemaining) override;
 
 	void HandleOnEntryInitializedInternal(UObject* Item, const TSharedRef<ITableRow>& TableRow);
 
@@ -156,6 +217,10 @@ protected:
 		MyListView = ITypedUMGDynamicListView<UObject*>::ConstructListView<ListViewT>(this, ListItems, Args);
 		
 		MyListView->SetOnEntryInitialized(SDynamicListView<UObject*>::FOnEntryInitialized::CreateUObject(this, &UDynamicListView::HandleOnEntryInitializedInternal));
+		if (bGetEntryLengthsFromItems)
+		{
+			MyListView->SetOnGetItemLength(SDynamicListView<UObject*>::FOnGetItemLength::CreateUObject(this, &UDynamicListView::HandleGetItemLength));
+		}
 
 		return StaticCastSharedRef<ListViewT<UObject*>>(MyListView.ToSharedRef());
 	}
@@ -193,6 +258,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
 	bool bReturnFocusToSelection = false;
 
+	/** True to get entry lengths from GetEntryLengthForItem, rather than by measuring entry widgets, whenever it provides one */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView)
+	bool bGetEntryLengthsFromItems = false;
+
+	/**
+	 * Most items the list keeps, 0 for no limit, e.g. for feeds that items keep being added to.
+	 * Adding items past it removes the first ones, a batch at a time so that adding stays cheap however many items the list keeps.
+	 * The entries in view that were not removed stay where they are.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListView, meta = (ClampMin = 0))
+	int32 MaxNumItems = 0;
+
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UObject>> ListItems;
 
@@ -233,6 +310,10 @@ private:
 	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Scroll Item Into View"))
 	void BP_ScrollItemIntoView(UObject* Item);
 
+	/** Measures the entry of the given item again on the next tick, e.g. after its content changed size. */
+	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Invalidate Item Length"))
+	void BP_InvalidateItemLength(UObject* Item);
+
 	/** Cancels a previous request to scroll and item into view. */
 	UFUNCTION(BlueprintCallable, Category = ListView, meta = (AllowPrivateAccess = true, DisplayName = "Cancel Scroll Into View"))
 	void BP_CancelScrollIntoView();
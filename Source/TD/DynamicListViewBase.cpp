@@ -64,7 +64,7 @@ void UDynamicListViewBase::ScrollToBottom()
 	}
 }
 
-void UDynamicListViewBase::SetScrollOffset(const float InScrollOffset)
+void UDynamicListViewBase::SetScrollOffset(const double InScrollOffset)
 {
 	if (MyTableViewBase.IsValid())
 	{
@@ -89,19 +89,28 @@ void UDynamicListViewBase::SetScrollbarVisibility(ESlateVisibility InVisibility)
 	}
 }
 
+void UDynamicListViewBase::SetStickToEnd(bool bInStickToEnd)
+{
+	bStickToEnd = bInStickToEnd;
+	if (MyTableViewBase)
+	{
+		MyTableViewBase->SetStickToEnd(bInStickToEnd);
+	}
+}
+
 const TArray<UUserWidget*>& UDynamicListViewBase::GetDisplayedEntryWidgets() const
 { 
 	return EntryWidgetPool.GetActiveWidgets(); 
 }
 
-float UDynamicListViewBase::GetScrollOffset() const
+double UDynamicListViewBase::GetScrollOffset() const
 {
 	if (MyTableViewBase.IsValid())
 	{
 		return MyTableViewBase->GetScrollOffset();
 	}
 
-	return 0.0f;
+	return 0.0;
 }
 
 TSharedRef<SWidget> UDynamicListViewBase::RebuildWidget()
@@ -138,6 +147,9 @@ TSharedRef<SWidget> UDynamicListViewBase::RebuildWidget()
 	MyTableViewBase->SetIsRightClickScrollingEnabled(bEnableRightClickScrolling);
 	MyTableViewBase->SetFixedLineScrollOffset(bEnableFixedLineOffset ? TOptional<double>(FixedLineScrollOffset) : TOptional<double>());
 	MyTableViewBase->SetWheelScrollMultiplier(WheelScrollMultiplier);
+	MyTableViewBase->SetUseEstimatedItemLengths(bUseEstimatedEntryLengths, EstimatedEntryLength);
+	MyTableViewBase->SetItemMeasurementBudget(EntryMeasurementBudgetMs);
+	MyTableViewBase->SetStickToEnd(bStickToEnd);
 
 	return MyTableViewBase.ToSharedRef();
 }
@@ -162,6 +174,9 @@ void UDynamicListViewBase::SynchronizeProperties()
 		MyTableViewBase->SetAllowOverscroll(AllowOverscroll ? EAllowOverscroll::Yes : EAllowOverscroll::No);
 		MyTableViewBase->SetFixedLineScrollOffset(bEnableFixedLineOffset ? TOptional<double>(FixedLineScrollOffset) : TOptional<double>());
 		MyTableViewBase->SetWheelScrollMultiplier(WheelScrollMultiplier);
+		MyTableViewBase->SetUseEstimatedItemLengths(bUseEstimatedEntryLengths, EstimatedEntryLength);
+		MyTableViewBase->SetItemMeasurementBudget(EntryMeasurementBudgetMs);
+		MyTableViewBase->SetStickToEnd(bStickToEnd);
 	}
 
 #if WITH_EDITORONLY_DATA
@@ -192,6 +207,38 @@ void UDynamicListViewBase::RequestRefresh()
 	}
 }
 
+void UDynamicListViewBase::InvalidateItemLengthRange(int32 StartIndex, int32 NumItems)
+{
+	if (MyTableViewBase.IsValid())
+	{
+		MyTableViewBase->InvalidateItemLengthRange(StartIndex, NumItems);
+	}
+}
+
+void UDynamicListViewBase::SetEntryMeasurementBudget(float MillisecondsPerFrame)
+{
+	EntryMeasurementBudgetMs = MillisecondsPerFrame;
+	if (MyTableViewBase.IsValid())
+	{
+		MyTableViewBase->SetItemMeasurementBudget(MillisecondsPerFrame);
+	}
+}
+
+bool UDynamicListViewBase::IsMeasuringEntries() const
+{
+	return MyTableViewBase.IsValid() && MyTableViewBase->IsMeasuringItems();
+}
+
+float UDynamicListViewBase::GetEntryMeasurementProgress() const
+{
+	if (MyTableViewBase.IsValid())
+	{
+		return MyTableViewBase->GetItemMeasurementProgress();
+	}
+
+	return 0.0f;
+}
+
 void UDynamicListViewBase::HandleRowReleased(const TSharedRef<ITableRow>& Row)
 {
 	UUserWidget* EntryWidget = StaticCastSharedRef<IObjectTableRow>(Row)->GetUserWidget();
@@ -31,7 +31,7 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemSelectionChanged, NullableItemType);
 	virtual FOnItemSelectionChanged& OnItemSelectionChanged() const = 0;
 
-	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnListViewScrolled, float, float);
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnListViewScrolled, double, float);
 	virtual FOnListViewScrolled& OnListViewScrolled() const = 0;
 
 	DECLARE_MULTICAST_DELEGATE(FOnFinishedScrolling);
@@ -82,11 +82,7 @@ public:
 	{
 		if (SDynamicListView<ItemType>* MyListView = GetMyListView())
 		{
-			TArray<ItemType> SelectedItems = MyListView->GetSelectedItems();
-			if (SelectedItems.Num() > 0)
-			{
-				return SelectedItems[0];
-			}
+			return MyListView->GetFirstSelectedItem();
 		}
 		return nullptr;
 	}
@@ -192,6 +188,14 @@ public:
 		}
 	}
 
+	void RequestScrollItemIntoView(const ItemType& Item, EDescendantScrollDestination Alignment, float Padding = 0.f)
+	{
+		if (SDynamicListView<ItemType>* MyListView = GetMyListView())
+		{
+			MyListView->RequestScrollIntoView(Item, Alignment, Padding, GetOwningUserIndex());
+		}
+	}
+
 	void CancelScrollIntoView()
 	{
 		if (SDynamicListView<ItemType>* MyListView = GetMyListView())
@@ -199,6 +203,14 @@ public:
 			MyListView->CancelScrollIntoView();
 		}
 	}
+
+	void InvalidateItemLength(const ItemType& Item)
+	{
+		if (SDynamicListView<ItemType>* MyListView = GetMyListView())
+		{
+			MyListView->InvalidateItemLength(Item);
+		}
+	}
 	//////////////////////////////////////////////////////////////////////////
 
 protected:
@@ -239,6 +251,8 @@ protected:
 			.ScrollBarStyle(Args.ScrollBarStyle)
 			.PreventThrottling(Args.bPreventThrottling)
 			.OnGenerateRow_UObject(Implementer, &UListViewBaseT::HandleGenerateRow)
+			.OnEntryInitialized_UObject(Implementer, &UListViewBaseT::HandleEntryInitialized)
+			.OnGetEntryClassForItem_UObject(Implementer, &UListViewBaseT::GetDesiredEntryClassForItem)
 			.OnSelectionChanged_UObject(Implementer, &UListViewBaseT::HandleSelectionChanged)
 			.OnIsSelectableOrNavigable_UObject(Implementer, &UListViewBaseT::HandleIsSelectableOrNavigable)
 			.OnRowReleased_UObject(Implementer, &UListViewBaseT::HandleRowReleased)
@@ -357,25 +371,42 @@ protected:
 	virtual void OnSelectionChangedInternal(NullableItemType FirstSelectedItem) {}
 	virtual bool OnIsSelectableOrNavigableInternal(ItemType FirstSelectedItem) { return true; }
 	virtual void OnItemScrolledIntoViewInternal(ItemType Item, UUserWidget& EntryWidget) {}
-	virtual void OnListViewScrolledInternal(float ItemOffset, float DistanceRemaining) {}
+	virtual void OnListViewScrolledInternal(double ItemOffset, float DistanceRemaining) {}
 	virtual void OnItemExpansionChangedInternal(ItemType Item, bool bIsExpanded) {}
 
+	/**
+	 * Bound to the list's OnEntryInitialized by ConstructListView.
+	 * Child classes binding their own OnEntryInitialized handler must call this from it.
+	 */
+	void HandleEntryInitialized(ItemType Item, const TSharedRef<ITableRow>& TableRow)
+	{
+		// Rows used to measure items are re-bound to many items, which may each want a different padding
+		if (UUserWidget* EntryWidget = StaticCastSharedRef<IObjectDynamicTableRow>(TableRow)->GetUserWidget())
+		{
+			ApplyDesiredEntryPadding(*EntryWidget, Item);
+		}
+	}
+
 private:
 	TSharedRef<ITableRow> HandleGenerateRow(ItemType Item, const TSharedRef<SDynamicTableViewBase>& OwnerTable)
 	{
 		TSubclassOf<UUserWidget> DesiredEntryClass = GetDesiredEntryClassForItem(Item);
 
 		UUserWidget& EntryWidget = OnGenerateEntryWidgetInternal(Item, DesiredEntryClass, OwnerTable);
-		
-		// Combine the desired entry padding with the padding the widget wants natively on the CDO.
-		const FMargin DefaultPadding = EntryWidget.GetClass()->GetDefaultObject<UUserWidget>()->GetPadding();
-		EntryWidget.SetPadding(DefaultPadding + GetDesiredEntryPadding(Item));
+		ApplyDesiredEntryPadding(EntryWidget, Item);
 
 		TSharedPtr<SWidget> CachedWidget = EntryWidget.GetCachedWidget();
 		CachedWidget->SetCanTick(true); // this is a hack to force ticking to true so selection works (which should NOT require ticking! but currently does)
 		return StaticCastSharedPtr<SObjectTableRow<ItemType>>(CachedWidget).ToSharedRef();
 	}
 
+	void ApplyDesiredEntryPadding(UUserWidget& EntryWidget, ItemType Item)
+	{
+		// Combine the desired entry padding with the padding the widget wants natively on the CDO.
+		const FMargin DefaultPadding = EntryWidget.GetClass()->GetDefaultObject<UUserWidget>()->GetPadding();
+		EntryWidget.SetPadding(DefaultPadding + GetDesiredEntryPadding(Item));
+	}
+
 	void HandleItemClicked(ItemType Item)
 	{
 		OnItemClickedInternal(Item);
@@ -467,9 +498,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = ListViewBase)
 	const TArray<UUserWidget*>& GetDisplayedEntryWidgets() const;
 
-	/** Get the scroll offset of this view (in items) */
+	/** Get the scroll offset of this view, in Slate units from the start of the list */
 	UFUNCTION(BlueprintCallable, Category = ListViewBase)
-	float GetScrollOffset() const;
+	double GetScrollOffset() const;
 
 	/**
 	 * Full regeneration of all entries in the list. Note that the entry UWidget instances will not be destroyed, but they will be released and re-generated.
@@ -486,9 +517,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = ListViewBase)
 	void ScrollToBottom();
 
-	/** Set the scroll offset of this view (in items) */
+	/** Set the scroll offset of this view, in Slate units from the start of the list */
 	UFUNCTION(BlueprintCallable, Category = ListView)
-	void SetScrollOffset(const float InScrollOffset);
+	void SetScrollOffset(const double InScrollOffset);
 
 	UFUNCTION(BlueprintCallable, Category = ListViewBase)
 	void SetWheelScrollMultiplier(float NewWheelScrollMultiplier);
@@ -496,6 +527,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = ListViewBase)
 	void SetScrollbarVisibility(ESlateVisibility InVisibility);
 
+	/** Sets whether the view keeps to the end of the list while it is there, following the entries added at the end */
+	UFUNCTION(BlueprintCallable, Category = ListViewBase)
+	void SetStickToEnd(bool bInStickToEnd);
+
 	/**
 	 * Sets the list to refresh on the next tick.
 	 *
@@ -504,10 +539,31 @@ public:
 	 *
 	 * It does NOT account for changes within existing items - that is up to the item to announce and an entry to listen to as needed.
 	 * This can be onerous to set up for simple cases, so it's also reasonable (though not ideal) to call RegenerateAllEntries when changes within N list items need to be reflected.
+	 *
+	 * Items selected in bulk (select all, shift-click ranges) are deselected, as the list cannot tell where they went. Changing the items through the list, e.g. InsertItems or RemoveItems, keeps them.
 	 */
 	UFUNCTION(BlueprintCallable, Category = ListViewBase)
 	void RequestRefresh();
 
+	/**
+	 * Measures the entries of the given range of items again on the next tick, without re-measuring the whole list.
+	 * Use this instead of RequestRefresh when only the content of a few items changed, or when items were added at the end of the list.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ListViewBase)
+	void InvalidateItemLengthRange(int32 StartIndex, int32 NumItems);
+
+	/** Sets how many milliseconds per frame may be spent measuring entries in the background. 0 disables background measurement. */
+	UFUNCTION(BlueprintCallable, Category = ListViewBase)
+	void SetEntryMeasurementBudget(float MillisecondsPerFrame);
+
+	/** Returns true while entries are still being measured in the background, e.g. to show a "measuring" state */
+	UFUNCTION(BlueprintCallable, Category = ListViewBase)
+	bool IsMeasuringEntries() const;
+
+	/** Returns the fraction of the items whose entry length was measured rather than estimated, between 0 and 1 */
+	UFUNCTION(BlueprintCallable, Category = ListViewBase)
+	float GetEntryMeasurementProgress() const;
+
 	DECLARE_EVENT_OneParam(UListView, FOnListEntryGenerated, UUserWidget&);
 	FOnListEntryGenerated& OnEntryWidgetGenerated() { return OnListEntryGeneratedEvent; }
 
@@ -619,6 +675,24 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ListEntries, meta = (DesignerRebuild, AllowPrivateAccess = true, MustImplement = "/Script/UMG.UserListEntry"))
 	TSubclassOf<UUserWidget> EntryWidgetClass;
 
+	/**
+	 * True to start from an estimated entry length and only measure entries as they approach the visible area.
+	 * Recommended for lists with a very large number of items, which would otherwise all be measured before the first frame.
+	 */
+	UPROPERTY(EditAnywhere, Category = ListEntries)
+	bool bUseEstimatedEntryLengths = false;
+
+	/** Length assumed for the entries that were not measured yet. When 0, the running average of the measured entries is used. */
+	UPROPERTY(EditAnywhere, Category = ListEntries, meta = (EditCondition = bUseEstimatedEntryLengths, ClampMin = 0.0f))
+	float EstimatedEntryLength = 0.f;
+
+	/**
+	 * Milliseconds per frame spent measuring entries in the background, starting around the visible area and expanding outwards.
+	 * Entries start from an estimated length while they wait to be measured. 0 disables background measurement.
+	 */
+	UPROPERTY(EditAnywhere, Category = ListEntries, meta = (ClampMin = 0.0f, Units = "ms"))
+	float EntryMeasurementBudgetMs = 0.f;
+
 	/** The multiplier to apply when wheel scrolling */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Scrolling)
 	float WheelScrollMultiplier = 1.f;
@@ -646,6 +720,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category = Scrolling, meta = (EditCondition = bEnableFixedLineOffset, ClampMin = 0.0f, ClampMax = 0.5f))
 	float FixedLineScrollOffset = 0.f;
 
+	/**
+	 * True to keep the view at the end of the list while it is there, e.g. for chat or log feeds.
+	 * Entries added at the end are scrolled into view, unless the user scrolled away from the end, which keeps the entries in view where they are.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Scrolling)
+	bool bStickToEnd = false;
+
 	/** True to allow dragging of row widgets in the list */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input)
 	bool bAllowDragging = true;
@@ -0,0 +1,47 @@
+#include "IUserIndexDynamicListEntry.h"
+
+#include "Blueprint/UserWidget.h"
+#include "DynamicIndexListView.h"
+#include "SObjectDynamicTableRow.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(IUserIndexDynamicListEntry)
+
+UUserIndexDynamicListEntry::UUserIndexDynamicListEntry(const FObjectInitializer& Initializer)
+	: Super(Initializer)
+{
+}
+
+int32 IUserIndexDynamicListEntry::GetListItemIndex() const
+{
+	return UUserIndexDynamicListEntryLibrary::GetListItemIndex(Cast<UUserWidget>(const_cast<IUserIndexDynamicListEntry*>(this)));
+}
+
+void IUserIndexDynamicListEntry::NativeOnListItemIndexSet(int32 ListItemIndex)
+{
+	Execute_OnListItemIndexSet(Cast<UObject>(this), ListItemIndex);
+}
+
+void IUserIndexDynamicListEntry::SetListItemIndex(UUserWidget& ListEntryWidget, int32 ListItemIndex)
+{
+	if (IUserIndexDynamicListEntry* NativeImplementation = Cast<IUserIndexDynamicListEntry>(&ListEntryWidget))
+	{
+		NativeImplementation->NativeOnListItemIndexSet(ListItemIndex);
+	}
+	else if (ListEntryWidget.Implements<UUserIndexDynamicListEntry>())
+	{
+		Execute_OnListItemIndexSet(&ListEntryWidget, ListItemIndex);
+	}
+}
+
+int32 UUserIndexDynamicListEntryLibrary::GetListItemIndex(TScriptInterface<IUserIndexDynamicListEntry> UserIndexListEntry)
+{
+	if (const UUserWidget* EntryWidget = Cast<UUserWidget>(UserIndexListEntry.GetObject()))
+	{
+		const TSharedPtr<const IObjectDynamicTableRow> ObjectRow = IObjectDynamicTableRow::ObjectRowFromUserWidget(EntryWidget);
+		if (const UDynamicIndexListView* OwningListView = ObjectRow.IsValid() ? Cast<UDynamicIndexListView>(ObjectRow->GetOwningListView()) : nullptr)
+		{
+			return OwningListView->GetIndexForEntryWidget(EntryWidget);
+		}
+	}
+	return INDEX_NONE;
+}
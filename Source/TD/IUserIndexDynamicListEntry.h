@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Blueprint/IUserListEntry.h"
+#include "IUserIndexDynamicListEntry.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE()
+class UUserIndexDynamicListEntry : public UUserListEntry
+{
+	GENERATED_UINTERFACE_BODY()
+};
+
+/**
+ * Entry of a UDynamicIndexListView, which stands for the row at an index of data held outside the list rather than for an item object.
+ */
+class IUserIndexDynamicListEntry : public IUserListEntry
+{
+	GENERATED_IINTERFACE_BODY()
+
+public:
+	/** Returns the index of the row in the owning list view that this entry currently represents, INDEX_NONE if none */
+	int32 GetListItemIndex() const;
+
+protected:
+	/** Follows the same pattern as the NativeOn[X] methods in UUserWidget - super calls are expected in order to route the event to BP. */
+	virtual void NativeOnListItemIndexSet(int32 ListItemIndex);
+
+	/**
+	 * Called when this entry is assigned a row to represent by the owning list view, or when the data of its row changed.
+	 * The index is only current until rows are inserted or removed before it, read it again with GetListItemIndex when needed later.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = IndexListEntry)
+	void OnListItemIndexSet(int32 ListItemIndex);
+
+private:
+	template <typename> friend class SObjectDynamicTableRow;
+	friend class UDynamicIndexListView;
+	static void SetListItemIndex(UUserWidget& ListEntryWidget, int32 ListItemIndex);
+};
+
+/** Static library to supply "for free" functionality to widgets that implement IUserIndexDynamicListEntry */
+UCLASS()
+class UUserIndexDynamicListEntryLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Returns the index of the row in the owning list view that this entry is currently assigned to represent, INDEX_NONE if none.
+	 * Use it to read the row's data from wherever it is held.
+	 * @param UserIndexListEntry Note: Visually not transmitted, but this defaults to "self". No need to hook up if calling internally.
+	 */
+	UFUNCTION(BlueprintPure, Category = UserIndexListEntry, meta = (DefaultToSelf = UserIndexListEntry))
+	static int32 GetListItemIndex(TScriptInterface<IUserIndexDynamicListEntry> UserIndexListEntry);
+};
@@ -1,5 +1,6 @@
 ﻿#include "SDynamicListPanel.h"
 #include "Layout/ArrangedChildren.h"
+#include "Algo/BinarySearch.h"
 
 
 // Used to subtract a tiny amount from the available dimension to avoid floating point precision problems when arranging children
@@ -32,41 +33,44 @@ void SDynamicListPanel::OnArrangeChildren( const FGeometry& AllottedGeometry, FA
 {
 	if (Children.Num() > 0)
 	{
+		if (ChildOffsets.Num() != Children.Num() + 1)
+		{
+			UpdateChildOffsets();
+		}
+
 		const FTableViewDimensions AllottedDimensions(Orientation, AllottedGeometry.GetLocalSize());
-		FTableViewDimensions DimensionsSoFar(Orientation);
 
 		// This is a normal list, arrange items in a line along the scroll axis
-		float ScrollAxisOffset = 0.0f;
-		const int32 NumWholeWidgetsOffset = FMath::Min(FMath::Floor(FirstLineScrollOffset), Children.Num());
-		for (int32 ItemIndex = 0; ItemIndex < NumWholeWidgetsOffset; ++ItemIndex)
+		const int32 NumWholeWidgetsOffset = FMath::Clamp(FMath::FloorToInt(FirstLineScrollOffset), 0, Children.Num());
+		float ScrollAxisOffset = ChildOffsets[NumWholeWidgetsOffset];
+		if (Children.IsValidIndex(NumWholeWidgetsOffset))
 		{
-			const FTableViewDimensions CurrentChildDimensions(Orientation, Children[ItemIndex].GetWidget()->GetDesiredSize());
-			ScrollAxisOffset += CurrentChildDimensions.ScrollAxis;
+			ScrollAxisOffset += FMath::Frac(FirstLineScrollOffset) * (ChildOffsets[NumWholeWidgetsOffset + 1] - ChildOffsets[NumWholeWidgetsOffset]);
 		}
 
-		const int32 FractionalWidgetIndex = NumWholeWidgetsOffset;
-		if (Children.IsValidIndex(FractionalWidgetIndex))
+		const float FirstChildOffset = -FMath::FloorToInt(ScrollAxisOffset) - OverscrollAmount;
+
+		// Painting and hit testing only need the children overlapping the allotted geometry, searching for a widget needs them all
+		int32 FirstItemIndex = 0;
+		int32 EndItemIndex = Children.Num();
+		if (!ArrangedChildren.Accepts(EVisibility::Collapsed))
 		{
-			const FTableViewDimensions OffsetFractionChildDimensions(Orientation, Children[FractionalWidgetIndex].GetWidget()->GetDesiredSize());
-			ScrollAxisOffset += FMath::Frac(FirstLineScrollOffset) * OffsetFractionChildDimensions.ScrollAxis;
+			FirstItemIndex = FMath::Clamp(Algo::UpperBound(ChildOffsets, -FirstChildOffset) - 1, 0, Children.Num() - 1);
+			EndItemIndex = FMath::Min(Algo::LowerBound(ChildOffsets, AllottedDimensions.ScrollAxis - FirstChildOffset), Children.Num());
 		}
 
-		DimensionsSoFar.ScrollAxis = -FMath::FloorToInt(ScrollAxisOffset) - OverscrollAmount;
-
-		for (int32 ItemIndex = 0; ItemIndex < Children.Num(); ++ItemIndex)
+		for (int32 ItemIndex = FirstItemIndex; ItemIndex < EndItemIndex; ++ItemIndex)
 		{
-			const FTableViewDimensions WidgetDesiredDimensions(Orientation, Children[ItemIndex].GetWidget()->GetDesiredSize());
-			const bool bIsVisible = Children[ItemIndex].GetWidget()->GetVisibility().IsVisible();
-				
+			FTableViewDimensions ChildOffset(Orientation);
+			ChildOffset.ScrollAxis = FirstChildOffset + ChildOffsets[ItemIndex];
+
 			FTableViewDimensions FinalWidgetDimensions(Orientation);
-			FinalWidgetDimensions.ScrollAxis = bIsVisible ? WidgetDesiredDimensions.ScrollAxis : 0.f;
+			FinalWidgetDimensions.ScrollAxis = ChildOffsets[ItemIndex + 1] - ChildOffsets[ItemIndex];
 			FinalWidgetDimensions.LineAxis = AllottedDimensions.LineAxis;
 
 			ArrangedChildren.AddWidget(
-				AllottedGeometry.MakeChild(Children[ItemIndex].GetWidget(), DimensionsSoFar.ToVector2D(), FinalWidgetDimensions.ToVector2D())
+				AllottedGeometry.MakeChild(Children[ItemIndex].GetWidget(), ChildOffset.ToVector2D(), FinalWidgetDimensions.ToVector2D())
 			);
-
-			DimensionsSoFar.ScrollAxis += FinalWidgetDimensions.ScrollAxis;
 		}
 	}
 }
@@ -77,18 +81,31 @@ void SDynamicListPanel::Tick( const FGeometry& AllottedGeometry, const double In
 
 FVector2D SDynamicListPanel::ComputeDesiredSize( float ) const
 {
+	// The children were just prepassed, so this is where rows that resized while displayed are picked up
+	UpdateChildOffsets();
+
+	// Simply the sum of all the children along the scroll axis and the largest width along the line axis.
 	FTableViewDimensions DesiredListPanelDimensions(Orientation);
+	DesiredListPanelDimensions.ScrollAxis = ChildOffsets.Last();
+	DesiredListPanelDimensions.LineAxis = MaxChildLineAxisLength;
 	
-	// Simply the sum of all the children along the scroll axis and the largest width along the line axis.
+	return DesiredListPanelDimensions.ToVector2D();
+}
+
+void SDynamicListPanel::UpdateChildOffsets() const
+{
+	ChildOffsets.SetNumUninitialized(Children.Num() + 1, /*bAllowShrinking=*/false);
+	ChildOffsets[0] = 0.f;
+	MaxChildLineAxisLength = 0.f;
+
 	for (int32 ItemIndex = 0; ItemIndex < Children.Num(); ++ItemIndex)
 	{
-		// Notice that we do not respect child Visibility - it's not useful for ListPanels.
-		FTableViewDimensions ChildDimensions(Orientation, Children[ItemIndex].GetWidget()->GetDesiredSize());
-		DesiredListPanelDimensions.ScrollAxis += ChildDimensions.ScrollAxis;
-		DesiredListPanelDimensions.LineAxis = FMath::Max(DesiredListPanelDimensions.LineAxis, ChildDimensions.LineAxis);
+		const TSharedRef<SWidget>& ChildWidget = Children[ItemIndex].GetWidget();
+		const FTableViewDimensions ChildDimensions(Orientation, ChildWidget->GetDesiredSize());
+		const bool bIsVisible = ChildWidget->GetVisibility().IsVisible();
+		ChildOffsets[ItemIndex + 1] = ChildOffsets[ItemIndex] + (bIsVisible ? ChildDimensions.ScrollAxis : 0.f);
+		MaxChildLineAxisLength = FMath::Max(MaxChildLineAxisLength, ChildDimensions.LineAxis);
 	}
-	
-	return DesiredListPanelDimensions.ToVector2D();
 }
 
 FChildren* SDynamicListPanel::GetAllChildren()
@@ -125,6 +142,93 @@ void SDynamicListPanel::SetOverscrollAmount( float InOverscrollAmount )
 void SDynamicListPanel::ClearItems()
 {
 	Children.Empty();
+	ChildOffsets.Reset();
+	MaxChildLineAxisLength = 0.f;
+}
+
+bool SDynamicListPanel::SetItems(TArrayView<const TSharedRef<SWidget>> InWidgets, TArrayView<const float> InLengths)
+{
+	check(InWidgets.Num() == InLengths.Num());
+
+	const int32 NumOldItems = Children.Num();
+	const int32 NumNewItems = InWidgets.Num();
+
+	// Find where the old and new rows overlap: the new first row is among the old ones when scrolling forward,
+	// the old first row is among the new ones when scrolling backward
+	int32 OldOverlapStart = INDEX_NONE;
+	int32 NewOverlapStart = INDEX_NONE;
+	if (NumOldItems > 0 && NumNewItems > 0)
+	{
+		for (int32 OldIndex = 0; OldIndex < NumOldItems && OldOverlapStart == INDEX_NONE; ++OldIndex)
+		{
+			if (Children[OldIndex].GetWidget() == InWidgets[0])
+			{
+				OldOverlapStart = OldIndex;
+				NewOverlapStart = 0;
+			}
+		}
+
+		for (int32 NewIndex = 1; NewIndex < NumNewItems && OldOverlapStart == INDEX_NONE; ++NewIndex)
+		{
+			if (InWidgets[NewIndex] == Children[0].GetWidget())
+			{
+				OldOverlapStart = 0;
+				NewOverlapStart = NewIndex;
+			}
+		}
+	}
+
+	int32 OverlapLength = 0;
+	if (OldOverlapStart != INDEX_NONE)
+	{
+		while (OldOverlapStart + OverlapLength < NumOldItems
+			&& NewOverlapStart + OverlapLength < NumNewItems
+			&& Children[OldOverlapStart + OverlapLength].GetWidget() == InWidgets[NewOverlapStart + OverlapLength])
+		{
+			++OverlapLength;
+		}
+	}
+	else
+	{
+		OldOverlapStart = NumOldItems;
+		NewOverlapStart = NumNewItems;
+	}
+
+	// Drop the old rows on either side of the overlap
+	for (int32 OldIndex = NumOldItems - 1; OldIndex >= OldOverlapStart + OverlapLength; --OldIndex)
+	{
+		Children.RemoveAt(OldIndex);
+	}
+	for (int32 OldIndex = OldOverlapStart - 1; OldIndex >= 0; --OldIndex)
+	{
+		Children.RemoveAt(OldIndex);
+	}
+
+	// Then add the new ones on either side of it
+	for (int32 NewIndex = 0; NewIndex < NewOverlapStart; ++NewIndex)
+	{
+		AddSlot(NewIndex)
+		[
+			InWidgets[NewIndex]
+		];
+	}
+	for (int32 NewIndex = NewOverlapStart + OverlapLength; NewIndex < NumNewItems; ++NewIndex)
+	{
+		AddSlot()
+		[
+			InWidgets[NewIndex]
+		];
+	}
+
+	// The lengths measured while generating the rows place them until the next prepass
+	ChildOffsets.SetNumUninitialized(NumNewItems + 1, /*bAllowShrinking=*/false);
+	ChildOffsets[0] = 0.f;
+	for (int32 NewIndex = 0; NewIndex < NumNewItems; ++NewIndex)
+	{
+		ChildOffsets[NewIndex + 1] = ChildOffsets[NewIndex] + InLengths[NewIndex];
+	}
+
+	return OverlapLength != NumOldItems || OverlapLength != NumNewItems;
 }
 
 void SDynamicListPanel::SetRefreshPending( bool IsPendingRefresh )
@@ -65,6 +65,17 @@ public:
 	/** Remove all the children from this panel */
 	void ClearItems();
 
+	/**
+	 * Make the panel display exactly the given widgets, in order.
+	 * Slots of widgets that stay are kept: when the view moved along the list, only the rows that entered or left at either edge are added or removed.
+	 *
+	 * @param InWidgets    The widgets to display
+	 * @param InLengths    The length of each widget along the scroll axis as measured when it was generated, zero for widgets that are not visible
+	 *
+	 * @return True if the children changed.
+	 */
+	bool SetItems(TArrayView<const TSharedRef<SWidget>> InWidgets, TArrayView<const float> InLengths);
+
 	/** Tells the list panel whether items in the list are pending a refresh */
 	void SetRefreshPending( bool IsPendingRefresh );
 
@@ -73,9 +84,21 @@ public:
 	
 protected:
 
+	/** Rebuild the cached child offsets from the desired size of the children, when they are missing or as the children resize while displayed */
+	void UpdateChildOffsets() const;
+
 	/** The children being arranged by this panel */
 	TPanelChildren<FSlot> Children;
 	
+	/**
+	 * Offset of each child along the scroll axis from the start of the first one, plus the total length of the children at the end.
+	 * Lengths of children that are not visible are zero, as they are arranged.
+	 */
+	mutable TArray<float> ChildOffsets;
+
+	/** Largest desired size of the children along the line axis */
+	mutable float MaxChildLineAxisLength = 0.f;
+
 	/** Total number of items that the tree wants to visualize */
 	TAttribute<int32> NumDesiredItems;
 	
@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Containers/ArrayView.h"
 #include "InputCoreTypes.h"
+#include "DynamicListDataSource.h"
+#include "DynamicListItemLengthCache.h"
+#include "DynamicListSelectionRanges.h"
 #include "SDynamicTableRow.h"
 #include "SDynamicTableViewBase.h"
 #include "SObjectDynamicTableRow.h"
@@ -20,11 +23,13 @@
 #include "Framework/Views/TableViewTypeTraits.h"
 #include "Widgets/Views/STableRow.h"
 #include "Types/SlateConstants.h"
+#include "Types/SlateEnums.h"
 #include "Widgets/Layout/SScrollBar.h"
 #include "Framework/Layout/Overscroll.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/SOverlay.h"
 #include "Application/SlateApplicationBase.h"
+#include "UObject/UObjectGlobals.h"
 #if WITH_ACCESSIBILITY
 #include "GenericPlatform/Accessibility/GenericAccessibleInterfaces.h"
 #include "Widgets/Accessibility/SlateCoreAccessibleWidgets.h"
@@ -75,6 +80,10 @@ public:
 	DECLARE_DELEGATE_OneParam( FOnWidgetToBeRemoved, const TSharedRef<ITableRow>& );
 
 	DECLARE_DELEGATE_TwoParams( FOnEntryInitialized, ItemType, const TSharedRef<ITableRow>& );
+
+	DECLARE_DELEGATE_RetVal_OneParam( TSubclassOf<UUserWidget>, FOnGetEntryClassForItem, ItemType );
+
+	DECLARE_DELEGATE_RetVal_OneParam( TOptional<float>, FOnGetItemLength, ItemType );
 	
 public:
 	SLATE_BEGIN_ARGS(SDynamicListView<ItemType>)
@@ -82,8 +91,11 @@ public:
 		, _OnGenerateRow()
 		, _OnGeneratePinnedRow()
 		, _OnEntryInitialized()
+		, _OnGetEntryClassForItem()
+		, _OnGetItemLength()
 		, _OnRowReleased()
 		, _ListItemsSource()
+		, _DataSource()
 		, _ItemHeight(16)
 		, _MaxPinnedItems(6)
 		, _OnContextMenuOpening()
@@ -103,6 +115,10 @@ public:
 		, _ConsumeMouseWheel(EConsumeMouseWheel::WhenScrollingPossible)
 		, _WheelScrollMultiplier(GetGlobalScrollAmount())
 		, _NavigationScrollOffset(0.5f)
+		, _UseEstimatedItemLengths(false)
+		, _EstimatedItemLength(0.f)
+		, _ItemMeasurementBudget(0.f)
+		, _StickToEnd(false)
 		, _HandleGamepadEvents( true )
 		, _HandleDirectionalNavigation( true )
 		, _HandleSpacebarSelection(false)
@@ -122,6 +138,12 @@ public:
 
 		SLATE_EVENT( FOnEntryInitialized, OnEntryInitialized )
 
+		/** Which entry class an item is displayed with, so that items are measured with a row of the right class */
+		SLATE_EVENT( FOnGetEntryClassForItem, OnGetEntryClassForItem )
+
+		/** The length of an item along the scroll axis when it is known from the data alone. Items it returns a length for are never measured with a widget. */
+		SLATE_EVENT( FOnGetItemLength, OnGetItemLength )
+
 		SLATE_EVENT( FOnWidgetToBeRemoved, OnRowReleased )
 
 		SLATE_EVENT( FOnTableViewScrolled, OnListViewScrolled )
@@ -132,6 +154,9 @@ public:
 
 		SLATE_ARGUMENT( const TArray<ItemType>* , ListItemsSource )
 
+		/** Produces the items by index instead of ListItemsSource, for lists too long to hold all their items in memory */
+		SLATE_ARGUMENT( TSharedPtr<IDynamicListDataSource<ItemType>>, DataSource )
+
 		SLATE_ATTRIBUTE( float, ItemHeight )
 
 		SLATE_ATTRIBUTE(int32, MaxPinnedItems)
@@ -176,6 +201,18 @@ public:
 
 		SLATE_ARGUMENT( float, NavigationScrollOffset );
 
+		/** Start from an estimated length for every item and measure items only as they approach the visible area */
+		SLATE_ARGUMENT( bool, UseEstimatedItemLengths );
+
+		/** Length assumed for the items that were not measured yet. When 0, the running average of the measured lengths is used. */
+		SLATE_ARGUMENT( float, EstimatedItemLength );
+
+		/** Milliseconds per frame spent measuring the items still holding an estimated length, outwards from the visible area. 0 to disable. */
+		SLATE_ARGUMENT( float, ItemMeasurementBudget );
+
+		/** Keep the view at the end of the list while it is there, e.g. for feeds items keep being appended to */
+		SLATE_ARGUMENT( bool, StickToEnd );
+
 		SLATE_ARGUMENT( bool, HandleGamepadEvents );
 
 		SLATE_ARGUMENT( bool, HandleDirectionalNavigation );
@@ -205,6 +242,8 @@ public:
 		this->OnGenerateRow = InArgs._OnGenerateRow;
 		this->OnGeneratePinnedRow = InArgs._OnGeneratePinnedRow;
 		this->OnEntryInitialized = InArgs._OnEntryInitialized;
+		this->OnGetEntryClassForItem = InArgs._OnGetEntryClassForItem;
+		this->OnGetItemLength = InArgs._OnGetItemLength;
 		this->OnRowReleased = InArgs._OnRowReleased;
 		this->OnItemScrolledIntoView = InArgs._OnItemScrolledIntoView;
 		this->OnFinishedScrolling = InArgs._OnFinishedScrolling;
@@ -212,6 +251,10 @@ public:
 		PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		this->SetItemsSource(InArgs._ListItemsSource);
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
+		if (InArgs._DataSource.IsValid())
+		{
+			this->SetDataSource(InArgs._DataSource);
+		}
 
 		this->OnContextMenuOpening = InArgs._OnContextMenuOpening;
 		this->OnClick = InArgs._OnMouseButtonClick;
@@ -226,6 +269,14 @@ public:
 		this->ConsumeMouseWheel = InArgs._ConsumeMouseWheel;
 		this->WheelScrollMultiplier = InArgs._WheelScrollMultiplier;
 		this->NavigationScrollOffset = InArgs._NavigationScrollOffset;
+		this->SetUseEstimatedItemLengths(InArgs._UseEstimatedItemLengths, InArgs._EstimatedItemLength);
+		this->SetItemMeasurementBudget(InArgs._ItemMeasurementBudget);
+		this->SetStickToEnd(InArgs._StickToEnd);
+
+		if (TDynamicListItemKeyTraits<ItemType>::bCanExpire)
+		{
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddSP(this, &SDynamicListView<ItemType>::PurgeExpiredItemLengths);
+		}
 
 		this->bHandleGamepadEvents = InArgs._HandleGamepadEvents;
 		this->bHandleDirectionalNavigation = InArgs._HandleDirectionalNavigation;
@@ -259,7 +310,7 @@ public:
 
 			if ( !this->HasValidItemsSource() )
 			{
-				ErrorString += TEXT("Please specify a ListItemsSource. \n");
+				ErrorString += TEXT("Please specify a ListItemsSource or a DataSource. \n");
 			}
 		}
 
@@ -328,7 +379,7 @@ public:
 			}
 		}
 
-		const TArrayView<const ItemType> ItemsSourceRef = GetItems();
+		const TDynamicListItems<ItemType> ItemsSourceRef = GetItems();
 
 		// Don't respond to key-presses containing "Alt" as a modifier
 		if ( ItemsSourceRef.Num() > 0 && !InKeyEvent.IsAltDown() )
@@ -354,7 +405,7 @@ public:
 				int32 SelectionIndex = 0;
 				if( TListTypeTraits<ItemType>::IsPtrValid(SelectorItem) )
 				{
-					SelectionIndex = ItemsSourceRef.Find( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( SelectorItem ) );
+					SelectionIndex = GetIndexOfItem( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( SelectorItem ) );
 				}
 
 				int32 NumItemsInAPage = FMath::TruncToInt(GetNumLiveWidgets());
@@ -378,7 +429,7 @@ public:
 				int32 SelectionIndex = 0;
 				if( TListTypeTraits<ItemType>::IsPtrValid(SelectorItem) )
 				{
-					SelectionIndex = ItemsSourceRef.Find( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( SelectorItem ) );
+					SelectionIndex = GetIndexOfItem( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( SelectorItem ) );
 				}
 
 				int32 NumItemsInAPage = FMath::TruncToInt(GetNumLiveWidgets());
@@ -447,9 +498,9 @@ public:
 				{
 					this->Private_ClearSelection();
 
-					for ( int32 ItemIdx = 0; ItemIdx < ItemsSourceRef.Num(); ++ItemIdx )
+					if ( ItemsSourceRef.Num() > 0 )
 					{
-						this->Private_SetItemSelection( ItemsSourceRef[ItemIdx], true );
+						SelectItemRange( 0, ItemsSourceRef.Num() - 1 );
 					}
 
 					this->Private_SignalSelectionChanged(ESelectInfo::OnKeyPress);
@@ -478,10 +529,10 @@ public:
 	{
 		if (this->HasValidItemsSource() && this->bHandleDirectionalNavigation && (this->bHandleGamepadEvents || InNavigationEvent.GetNavigationGenesis() != ENavigationGenesis::Controller))
 		{
-			const TArrayView<const ItemType> ItemsSourceRef = this->GetItems();
+			const TDynamicListItems<ItemType> ItemsSourceRef = this->GetItems();
 
 			const int32 NumItemsPerLine = GetNumItemsPerLine();
-			const int32 CurSelectionIndex = (!TListTypeTraits<ItemType>::IsPtrValid(SelectorItem)) ? -1 : ItemsSourceRef.Find(TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType(SelectorItem));
+			const int32 CurSelectionIndex = (!TListTypeTraits<ItemType>::IsPtrValid(SelectorItem)) ? -1 : GetIndexOfItem(TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType(SelectorItem));
 			int32 AttemptSelectIndex = -1;
 
 			const EUINavigation NavType = InNavigationEvent.GetNavigationType();
@@ -611,13 +662,11 @@ public:
 			if (Widget.IsValid())
 			{
 				TSharedPtr<SDynamicListView<ItemType>> ListView = StaticCastSharedPtr<SDynamicListView<ItemType>>(Widget.Pin());
-				SelectedItemsArray.Empty(ListView ->SelectedItems.Num());
-				for (typename TItemSet::TConstIterator SelectedItemIt(ListView ->SelectedItems); SelectedItemIt; ++SelectedItemIt)
+				// This is only valid if the item is visible, so only look at the generated rows rather than every selected item
+				for (auto ItemToWidgetIt = ListView->WidgetGenerator.ItemToWidgetMap.CreateConstIterator(); ItemToWidgetIt; ++ItemToWidgetIt)
 				{
-					const ItemType& CurrentItem = *SelectedItemIt;
-					// This is only valid if the item is visible
-					TSharedPtr < ITableRow> TableRow = ListView->WidgetGenerator.GetWidgetForItem(CurrentItem);
-					if (TableRow.IsValid())
+					TSharedPtr < ITableRow> TableRow = ItemToWidgetIt.Value();
+					if (ListView->Private_IsItemSelected(ItemToWidgetIt.Key()))
 					{
 						TSharedPtr<SWidget> TableRowWidget = TableRow->AsWidget();
 						TSharedPtr<IAccessibleWidget> AccessibleTableRow = FSlateAccessibleWidgetCache::GetAccessibleWidgetChecked(TableRowWidget);
@@ -705,7 +754,7 @@ private:
 		void OnItemSeen( ItemType InItem, TSharedRef<ITableRow> InGeneratedWidget)
 		{
 			ensure(TListTypeTraits<ItemType>::IsPtrValid(InItem));
-			TSharedRef<ITableRow>* LookupResult = ItemToWidgetMap.Find( InItem );
+			const TSharedRef<ITableRow>* LookupResult = ItemToWidgetMap.Find( InItem );
 			const bool bWidgetIsNewlyGenerated = (LookupResult == nullptr);
 			if ( bWidgetIsNewlyGenerated )
 			{
@@ -713,27 +762,41 @@ private:
 				ItemToWidgetMap.Add( InItem, InGeneratedWidget );
 				WidgetMapToItem.Add( &InGeneratedWidget.Get(), InItem );
 
+				FGeneratedRow& GeneratedRow = GeneratedRows.Add(&InGeneratedWidget.Get());
+				GeneratedRow.ItemToWidgetId = ItemToWidgetMap.FindId(InItem);
+				GeneratedRow.LastSeenGeneration = CurrentGeneration;
+				RowsSeenThisGeneration.Add(&InGeneratedWidget.Get());
+
 				// Now that the item-widget association is established, the generated row can fully initialize itself
 				InGeneratedWidget->InitializeRow();
 				OwnerList->Private_OnEntryInitialized(InItem, InGeneratedWidget);
 			}
+			else
+			{
+				// We should not clean up this item's widgets because it is in view.
+				const ITableRow* Row = &LookupResult->Get();
+				FGeneratedRow& GeneratedRow = GeneratedRows.FindChecked(Row);
+				if (GeneratedRow.LastSeenGeneration != CurrentGeneration)
+				{
+					GeneratedRow.LastSeenGeneration = CurrentGeneration;
+					RowsSeenThisGeneration.Add(Row);
+				}
+			}
 
-			// We should not clean up this item's widgets because it is in view.
-			ItemsToBeCleanedUp.Remove(InItem);
 			ItemsWithGeneratedWidgets.Add(InItem);
 		}
 
 		/**
 		 * Called at the beginning of the generation pass.
 		 * Begins tracking of which widgets were in view and which were not (so we can clean them up)
-		 * 
-		 * @param InNumDataItems   The total number of data items being observed
 		 */
 		void OnBeginGenerationPass()
 		{
-			// Assume all the previously generated items need to be cleaned up.				
-			ItemsToBeCleanedUp = ItemsWithGeneratedWidgets;
-			ItemsWithGeneratedWidgets.Empty();
+			// Rows not stamped with the new generation by the end of the pass get cleaned up
+			++CurrentGeneration;
+			Swap(RowsSeenThisGeneration, RowsSeenLastGeneration);
+			RowsSeenThisGeneration.Reset();
+			ItemsWithGeneratedWidgets.Reset();
 		}
 
 		/**
@@ -749,52 +812,66 @@ private:
 		/** Clear everything so widgets will be regenerated */
 		void Clear()
 		{
-			ItemsToBeCleanedUp = ItemsWithGeneratedWidgets;
-			ItemsWithGeneratedWidgets.Empty();
+			++CurrentGeneration;
+			RowsSeenLastGeneration.Reset();
+			GeneratedRows.GetKeys(RowsSeenLastGeneration);
+			RowsSeenThisGeneration.Reset();
+			ItemsWithGeneratedWidgets.Reset();
 			ProcessItemCleanUp();
 		}
 
+		/** @return True if the row was newly generated, invalidated or last prepassed with a different layout scale, so its desired size cannot be trusted */
+		bool NeedsPrepass( const ITableRow& Row, float LayoutScaleMultiplier ) const
+		{
+			const FGeneratedRow* GeneratedRow = GeneratedRows.Find(&Row);
+			return GeneratedRow == nullptr || GeneratedRow->PrepassedLayoutScale != LayoutScaleMultiplier;
+		}
+
+		/** Remember that the row's desired size is valid for the given layout scale */
+		void OnRowPrepassed( const ITableRow& Row, float LayoutScaleMultiplier )
+		{
+			if (FGeneratedRow* GeneratedRow = GeneratedRows.Find(&Row))
+			{
+				GeneratedRow->PrepassedLayoutScale = LayoutScaleMultiplier;
+			}
+		}
+
+		/** Make the widget generated for this item, if any, get prepassed again the next time it is generated */
+		void InvalidatePrepass( const ItemType& Item )
+		{
+			if (const TSharedRef<ITableRow>* LookupResult = ItemToWidgetMap.Find(Item))
+			{
+				GeneratedRows.FindChecked(&LookupResult->Get()).PrepassedLayoutScale = 0.f;
+			}
+		}
+
+		/** Release the rows seen in the previous generation that were not seen in this one */
 		void ProcessItemCleanUp()
 		{
-			for (int32 ItemIndex = 0; ItemIndex < ItemsToBeCleanedUp.Num(); ++ItemIndex)
+			for (const ITableRow* Row : RowsSeenLastGeneration)
 			{
-				ItemType ItemToBeCleanedUp = ItemsToBeCleanedUp[ItemIndex];
-				const TSharedRef<ITableRow>* FindResult = ItemToWidgetMap.Find(ItemToBeCleanedUp);
-				if (FindResult != nullptr)
+				const FGeneratedRow* GeneratedRow = GeneratedRows.Find(Row);
+				if (GeneratedRow == nullptr || GeneratedRow->LastSeenGeneration == CurrentGeneration)
 				{
-					const TSharedRef<ITableRow> WidgetToCleanUp = *FindResult;
-					ItemToWidgetMap.Remove(ItemToBeCleanedUp);
-					WidgetMapToItem.Remove(&WidgetToCleanUp.Get());
-
-					if (ensureMsgf(OwnerList, TEXT("OwnerList is null, something is wrong.")))
-					{
-						WidgetToCleanUp->ResetRow();
-						OwnerList->OnRowReleased.ExecuteIfBound(WidgetToCleanUp);
-					}
+					continue;
 				}
-				else if(!TListTypeTraits<ItemType>::IsPtrValid(ItemToBeCleanedUp))
-				{
-					// If we get here, it means we have an invalid object. We will need to remove that object from both maps.
-					// This may happen for example when ItemType is a UObject* and the object is garbage collected.
-					auto Widget = WidgetMapToItem.FindKey(ItemToBeCleanedUp);
-					if (Widget != nullptr)
-					{
-						for (auto WidgetItemPair = ItemToWidgetMap.CreateIterator(); WidgetItemPair; ++WidgetItemPair)
-						{
-							const ITableRow* Item = &(WidgetItemPair.Value().Get());
-							if (Item == *Widget)
-							{
-								WidgetItemPair.RemoveCurrent();
-								break;
-							}
-						}
 
-						WidgetMapToItem.Remove(*Widget);
-					}
+				// Rows are released through the element they were added with, which stays valid even when the item itself
+				// no longer hashes to it, e.g. when ItemType is a UObject* and the object is garbage collected.
+				const FSetElementId ItemToWidgetId = GeneratedRow->ItemToWidgetId;
+				const TSharedRef<ITableRow> WidgetToCleanUp = ItemToWidgetMap.Get(ItemToWidgetId).Value;
+				ItemToWidgetMap.Remove(ItemToWidgetId);
+				WidgetMapToItem.Remove(Row);
+				GeneratedRows.Remove(Row);
+
+				if (ensureMsgf(OwnerList, TEXT("OwnerList is null, something is wrong.")))
+				{
+					WidgetToCleanUp->ResetRow();
+					OwnerList->OnRowReleased.ExecuteIfBound(WidgetToCleanUp);
 				}
 			}
 
-			ItemsToBeCleanedUp.Reset();
+			RowsSeenLastGeneration.Reset();
 		}
 
 		void ValidateWidgetGeneration()
@@ -867,11 +944,31 @@ private:
 		/** A set of Items that currently have a generated widget */
 		TArray< ItemType > ItemsWithGeneratedWidgets;
 
+		/** Bookkeeping for a generated widget */
+		struct FGeneratedRow
+		{
+			/** Where the widget is in ItemToWidgetMap */
+			FSetElementId ItemToWidgetId;
+
+			/** The last generation pass the widget was seen in */
+			uint32 LastSeenGeneration = 0;
+
+			/** Layout scale the widget was last prepassed with, 0 when it needs a prepass before its desired size is used */
+			float PrepassedLayoutScale = 0.f;
+		};
+
+		/** Bookkeeping for every generated widget */
+		TMap< const ITableRow*, FGeneratedRow > GeneratedRows;
+
+		/** Incremented by every generation pass */
+		uint32 CurrentGeneration = 0;
+
+		/** Widgets seen in the current and in the previous generation pass; only the latter can need cleaning up */
+		TArray< const ITableRow* > RowsSeenThisGeneration;
+		TArray< const ITableRow* > RowsSeenLastGeneration;
+
 		/** Total number of DataItems the last time we performed a generation pass. */
 		int32 TotalItemsLastGeneration;
-
-		/** Items that need their widgets destroyed because they are no longer on screen. */
-		TArray<ItemType> ItemsToBeCleanedUp;
 	};
 	
 public:
@@ -892,13 +989,29 @@ public:
 			return;
 		}
 
+		// Entries of a data source are selected by index: the items standing for them may be swapped, e.g. placeholders for loaded items
+		const int32 DataSourceItemIndex = DataSource.IsValid() ? GetIndexOfItem( TheItem ) : INDEX_NONE;
+
 		if ( bShouldBeSelected )
 		{
-			SelectedItems.Add( TheItem );
+			if ( DataSourceItemIndex != INDEX_NONE )
+			{
+				SelectItemRange( DataSourceItemIndex, DataSourceItemIndex );
+			}
+			// Items covered by a selected range are already selected
+			else if ( !IsItemInSelectedRanges( TheItem ) )
+			{
+				SelectedItems.Add( TheItem );
+			}
 		}
 		else
 		{
 			SelectedItems.Remove( TheItem );
+			if ( !SelectedRanges.IsEmpty() )
+			{
+				const int32 ItemIndex = GetIndexOfItem( TheItem );
+				SelectedRanges.Remove( ItemIndex, ItemIndex );
+			}
 		}
 
 		// Move the selector item and range selection start if the user directed this change in selection or if the list view is single selection
@@ -906,6 +1019,7 @@ public:
 		{
 			SelectorItem = TheItem;
 			RangeSelectionStart = TheItem;
+			RangeSelectionStartIndex = DataSourceItemIndex;
 		}
 
 		this->InertialScrollManager.ClearScrollVelocity();
@@ -932,6 +1046,7 @@ public:
 	virtual void Private_ClearSelection() override
 	{
 		SelectedItems.Empty();
+		SelectedRanges.Reset();
 
 		this->InertialScrollManager.ClearScrollVelocity();
 	}
@@ -943,28 +1058,33 @@ public:
 			return;
 		}
 
-		const TArrayView<const ItemType> ItemsSourceRef = GetItems();
+		const TDynamicListItems<ItemType> ItemsSourceRef = GetItems();
+		if ( ItemsSourceRef.Num() == 0 )
+		{
+			return;
+		}
 
 		int32 RangeStartIndex = 0;
-		if( TListTypeTraits<ItemType>::IsPtrValid(RangeSelectionStart) )
+		if ( RangeSelectionStartIndex != INDEX_NONE )
 		{
-			RangeStartIndex = ItemsSourceRef.Find( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( RangeSelectionStart ) );
+			RangeStartIndex = RangeSelectionStartIndex;
+		}
+		else if( TListTypeTraits<ItemType>::IsPtrValid(RangeSelectionStart) )
+		{
+			RangeStartIndex = GetIndexOfItem( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( RangeSelectionStart ) );
 		}
 
-		int32 RangeEndIndex = ItemsSourceRef.Find( InRangeSelectionEnd );
+		int32 RangeEndIndex = GetIndexOfItem( InRangeSelectionEnd );
 
-		RangeStartIndex = FMath::Clamp(RangeStartIndex, 0, ItemsSourceRef.Num());
-		RangeEndIndex = FMath::Clamp(RangeEndIndex, 0, ItemsSourceRef.Num());
+		RangeStartIndex = FMath::Clamp(RangeStartIndex, 0, ItemsSourceRef.Num() - 1);
+		RangeEndIndex = FMath::Clamp(RangeEndIndex, 0, ItemsSourceRef.Num() - 1);
 
 		if (RangeEndIndex < RangeStartIndex)
 		{
 			Swap( RangeStartIndex, RangeEndIndex );
 		}
 
-		for( int32 ItemIndex = RangeStartIndex; ItemIndex <= RangeEndIndex; ++ItemIndex )
-		{
-			SelectedItems.Add( ItemsSourceRef[ItemIndex] );
-		}
+		SelectItemRange( RangeStartIndex, RangeEndIndex );
 
 		this->InertialScrollManager.ClearScrollVelocity();
 	}
@@ -978,9 +1098,7 @@ public:
 
 		if( OnSelectionChanged.IsBound() )
 		{
-			NullableItemType SelectedItem = (SelectedItems.Num() > 0)
-				? (*typename TItemSet::TIterator(SelectedItems))
-				: TListTypeTraits< ItemType >::MakeNullPtr();
+			NullableItemType SelectedItem = GetFirstSelectedItem();
 
 			OnSelectionChanged.ExecuteIfBound(SelectedItem, SelectInfo );
 		}
@@ -1004,7 +1122,7 @@ public:
 
 	virtual bool Private_IsItemSelected( const ItemType& TheItem ) const override
 	{
-		return nullptr != SelectedItems.Find(TheItem);
+		return nullptr != SelectedItems.Find(TheItem) || IsItemInSelectedRanges(TheItem);
 	}
 
 	virtual bool Private_IsItemHighlighted(const ItemType& TheItem) const override
@@ -1041,7 +1159,7 @@ public:
 
 	virtual int32 Private_GetNumSelectedItems() const override
 	{
-		return SelectedItems.Num();
+		return SelectedItems.Num() + SelectedRanges.Num();
 	}
 
 	virtual void Private_SetItemHighlighted(ItemType TheItem, bool bShouldBeHighlighted) override
@@ -1143,43 +1261,57 @@ public:
 		OnEntryInitialized = Delegate;
 	}
 
+	/** Sets the OnGetItemLength delegate. When it returns a length for an item, that item is not measured with a widget. */
+	void SetOnGetItemLength(const FOnGetItemLength& Delegate)
+	{
+		OnGetItemLength = Delegate;
+
+		// Only the lengths change, the items and their selection stay
+		SDynamicTableViewBase::RequestListRefresh();
+	}
+
 	/**
 	 * Remove any items that are no longer in the list from the selection set.
 	 */
 	virtual void UpdateSelectionSet() override
 	{
+		// Items removed without telling us still show up as a smaller items source
+		const int32 NumItems = GetItems().Num();
+		bSelectionNeedsPruning |= NumItems < NumItemsWhenSelectionPruned;
+
 		// Trees take care of this update in a different way.
-		if ( TableViewMode != ETableViewMode::Tree )
+		// Selected items can only go away with items leaving the items source, so there is nothing to do while the items stay.
+		if ( TableViewMode != ETableViewMode::Tree && bSelectionNeedsPruning )
 		{
-			bool bSelectionChanged = false;
+			bSelectionNeedsPruning = false;
+			NumItemsWhenSelectionPruned = NumItems;
+
+			// Selected ranges already dropped the removed items as they were removed
+			bool bSelectionChanged = bSelectedRangesLostItems;
+			bSelectedRangesLostItems = false;
+
 			if ( !HasValidItemsSource() )
 			{
 				// We are no longer observing items so there is no more selection.
+				bSelectionChanged |= GetNumItemsSelected() > 0;
 				this->Private_ClearSelection();
-				bSelectionChanged = true;
 			}
 			else
 			{
+				const int32 NumSelectedInRanges = SelectedRanges.Num();
+				SelectedRanges.Truncate( NumItems );
+				bSelectionChanged |= SelectedRanges.Num() != NumSelectedInRanges;
+
 				// We are observing some items; they are potentially different.
-				// Unselect any that are no longer being observed.
-				TItemSet NewSelectedItems;
-				const TArrayView<const ItemType> Items = GetItems();
-				for ( int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex )
+				// Unselect any that are no longer being observed, looking each selected item up rather than going through all the items.
+				for ( auto SelectedItemIt = SelectedItems.CreateIterator(); SelectedItemIt; ++SelectedItemIt )
 				{
-					ItemType CurItem = Items[ItemIndex];
-					const bool bItemIsSelected = ( nullptr != SelectedItems.Find( CurItem ) );
-					if ( bItemIsSelected )
+					if ( GetIndexOfItem( *SelectedItemIt ) == INDEX_NONE )
 					{
-						NewSelectedItems.Add( CurItem );
+						SelectedItemIt.RemoveCurrent();
+						bSelectionChanged = true;
 					}
 				}
-
-				// Look for items that were removed from the selection.
-				TItemSet SetDifference = SelectedItems.Difference( NewSelectedItems );
-				bSelectionChanged = (SetDifference.Num()) > 0;
-
-				// Update the selection to reflect the removal of any items from the ItemsSource.
-				SelectedItems = NewSelectedItems;
 			}
 
 			if (bSelectionChanged)
@@ -1195,18 +1327,22 @@ public:
 	 */
 	virtual FReGenerateResults ReGenerateItems( const FGeometry& MyGeometry ) override
 	{
-		auto DoubleFractional = [](double Value) -> double
-		{
-			return Value - FMath::TruncToDouble(Value);
-		};
+		// The panel keeps its current items, the widgets we add are handed to it in order once we are done
+		// so that only the rows that entered or left the view get added or removed.
 
-		// Clear all the items from our panel. We will re-add them in the correct order momentarily.
-		this->ClearWidgets();
+		if (DataSource.IsValid() && DataSource->Num() > 0)
+		{
+			// Let the source load around the items in view before we read them
+			const FTableViewDimensions ViewDimensions(this->Orientation, MyGeometry.GetLocalSize());
+			const int32 FirstIndexInView = FMath::Clamp(CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset), 0, DataSource->Num() - 1);
+			const int32 LastIndexInView = FMath::Clamp(CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset + ViewDimensions.ScrollAxis), FirstIndexInView, DataSource->Num() - 1);
+			DataSource->SetItemsInView(FirstIndexInView, LastIndexInView, IsScrollingBackward());
+		}
 
 		// Ensure that we always begin and clean up a generation pass.
 		FGenerationPassGuard GenerationPassGuard(WidgetGenerator);
 
-		const TArrayView<const ItemType> Items = GetItems();
+		const TDynamicListItems<ItemType> Items = GetItems();
 		if (Items.Num() > 0)
 		{
 			// Items in view, including fractional items
@@ -1220,19 +1356,7 @@ public:
 
 			// Index of the item at which we start generating based on how far scrolled down we are
 			// Note that we must generate at LEAST one item.
-			int32 StartIndex = 0;
-			double PrevItemsLength = 0;
-			for ( int32 Index = 0; Index < CachedItemLengths.Num(); Index++ )
-			{
-				PrevItemsLength += CachedItemLengths[Index];
-
-				if (CurrentScrollOffset < PrevItemsLength)
-				{
-					StartIndex = Index;
-					break;
-				}
-			}
-			// int32 StartIndex = FMath::Clamp( (int32)(FMath::FloorToDouble(CurrentScrollOffset)), 0, Items.Num() - 1 );
+			const int32 StartIndex = FMath::Clamp(CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset), 0, Items.Num() - 1);
 
 			// Length of the first item that is generated. This item is at the location where the user requested we scroll
 			float FirstItemLength = 0.0f;
@@ -1266,30 +1390,14 @@ public:
 				// Track the number of items in the view, including fractions.
 				if (bIsFirstItem)
 				{
-					double SumOfItemLengths = 0;
 					float FirstItemFraction = 1.f;
-					for (const float CachedItemLength : CachedItemLengths)
+					if (CachedItemLengths.IsValidIndex(StartIndex) && CachedItemLengths.GetLength(StartIndex) > 0.f)
 					{
-						SumOfItemLengths += CachedItemLength;
-			
-						if (CurrentScrollOffset <= SumOfItemLengths)
-						{
-							FirstItemFraction = (SumOfItemLengths - CurrentScrollOffset) / CachedItemLength;
-							break;
-						}
+						const double FirstItemEnd = CachedItemLengths.GetOffsetOf(StartIndex + 1);
+						FirstItemFraction = (float)FMath::Clamp((FirstItemEnd - CurrentScrollOffset) / CachedItemLengths.GetLength(StartIndex), 0.0, 1.0);
 					}
 
 					// The first item may not be fully visible (but cannot exceed 1)
-					// FirstItemFractionScrolledIntoView is the fraction of the item that is visible after taking into account anything that may be scrolled off the top/left of the list view
-					const float FirstItemFractionScrolledIntoView = 1.0f - (float)FMath::Max(DoubleFractional(CurrentScrollOffset), 0.0);
-					
-					// FirstItemLengthScrolledIntoView is the length of the item, ignoring anything that is scrolled off the top/left of the list view
-					const float FirstItemLengthScrolledIntoView = ItemLength * FirstItemFractionScrolledIntoView;
-					
-					// FirstItemVisibleFraction is either: The visible item length as a fraction of the available list view length (if the item size is larger than the available size, otherwise this will be >1), or just FirstItemFractionScrolledIntoView (which can never be >1)
-					const float FirstItemVisibleFraction = FMath::Min(MyDimensions.ScrollAxis / FirstItemLengthScrolledIntoView, FirstItemFractionScrolledIntoView);
-					
-					// ItemsInView += FirstItemVisibleFraction; // TODO
 					ItemsInView += FirstItemFraction;
 				}
 				else if (ViewLengthUsedSoFar + ItemLength > MyDimensions.ScrollAxis)
@@ -1350,7 +1458,7 @@ public:
 					}
 				}
 
-				float NewOffset = GetTotalItemsLength() - MyGeometry.GetLocalSize().Y;
+				const double NewOffset = GetTotalItemsLength() - MyDimensions.ScrollAxis;
 				return FReGenerateResults(NewOffset, LengthGeneratedSoFar, ItemsInView, true);
 			}
 
@@ -1380,24 +1488,37 @@ public:
 		WidgetGenerator.OnItemSeen( CurItem, WidgetForItem.ToSharedRef() );
 
 		// We rely on the widgets desired size in order to determine how many will fit on screen.
+		// Rows kept from the previous pass were already prepassed, and Slate keeps their desired size up to date while they are displayed.
 		const TSharedRef<SWidget> NewlyGeneratedWidget = WidgetForItem->AsWidget();
-		NewlyGeneratedWidget->MarkPrepassAsDirty();
-		NewlyGeneratedWidget->SlatePrepass(LayoutScaleMultiplier);
+		if (WidgetGenerator.NeedsPrepass(*WidgetForItem, LayoutScaleMultiplier))
+		{
+			NewlyGeneratedWidget->MarkPrepassAsDirty();
+			NewlyGeneratedWidget->SlatePrepass(LayoutScaleMultiplier);
+			WidgetGenerator.OnRowPrepassed(*WidgetForItem, LayoutScaleMultiplier);
+
+			// The row just measured its item, so the length does not need measuring again after a refresh
+			if (NewlyGeneratedWidget->GetVisibility().IsVisible() && !DataSource.IsValid() && !GetKnownItemLength(ItemIndex).IsSet())
+			{
+				const FTableViewDimensions MeasuredDimensions(this->Orientation, NewlyGeneratedWidget->GetDesiredSize());
+				ItemLengthCache.Add(CurItem, MakeItemLengthContext(GetMeasurementEntryClass(CurItem), LayoutScaleMultiplier), MeasuredDimensions.ScrollAxis);
+			}
+		}
+
+		const bool bIsVisible = NewlyGeneratedWidget->GetVisibility().IsVisible();
+		FTableViewDimensions GeneratedWidgetDimensions(this->Orientation, bIsVisible ? NewlyGeneratedWidget->GetDesiredSize() : FVector2D::ZeroVector);
 
 		// We have a widget for this item; add it to the panel so that it is part of the UI.
 		if (ItemIndex >= StartIndex)
 		{
 			// Generating widgets downward
-			this->AppendWidget( WidgetForItem.ToSharedRef() );
+			this->AppendWidget( WidgetForItem.ToSharedRef(), GeneratedWidgetDimensions.ScrollAxis );
 		}
 		else
 		{
 			// Backfilling widgets; going upward
-			this->InsertWidget( WidgetForItem.ToSharedRef() );
+			this->InsertWidget( WidgetForItem.ToSharedRef(), GeneratedWidgetDimensions.ScrollAxis );
 		}
 
-		const bool bIsVisible = NewlyGeneratedWidget->GetVisibility().IsVisible();
-		FTableViewDimensions GeneratedWidgetDimensions(this->Orientation, bIsVisible ? NewlyGeneratedWidget->GetDesiredSize() : FVector2D::ZeroVector);
 		return GeneratedWidgetDimensions.ScrollAxis;
 	}
 
@@ -1433,7 +1554,7 @@ public:
 		}
 		
 
-		const TArrayView<const ItemType> ItemsSourceRef = this->GetItems();
+		const TDynamicListItems<ItemType> ItemsSourceRef = this->GetItems();
 
 		for (int32 ItemIndex = 0; ItemIndex < InItems.Num(); ++ItemIndex)
 		{
@@ -1486,6 +1607,12 @@ public:
 		return GetItems().Num();
 	}
 
+	/** Items of a data source are made on demand, measuring all of them up front would make every one of them */
+	virtual bool ShouldEstimateItemLengths() const override
+	{
+		return DataSource.IsValid() || SDynamicTableViewBase::ShouldEstimateItemLengths();
+	}
+
 	virtual TSharedRef<ITableRow> GenerateNewPinnedWidget(ItemType InItem, const int32 ItemIndex, const int32 NumPinnedItems)
 	{
 		if (OnGeneratePinnedRow.IsBound())
@@ -1509,21 +1636,14 @@ public:
 
 	virtual float GetFirstLineScrollOffset() const override
 	{
-		double FirstLineScrollOffset = CurrentScrollOffset;
-
-		double AboveItemsLength = 0;
-		for (const float ItemLength : CachedItemLengths)
+		const int32 FirstItemIndex = CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset);
+		if (FirstItemIndex == INDEX_NONE || CachedItemLengths.GetLength(FirstItemIndex) <= 0.f)
 		{
-			AboveItemsLength += ItemLength;
-			
-			if (CurrentScrollOffset <= AboveItemsLength && ItemLength > 0)
-			{
-				FirstLineScrollOffset = (ItemLength - (AboveItemsLength - CurrentScrollOffset)) / ItemLength;
-				break;
-			}
+			return 0.f;
 		}
 
-		return FirstLineScrollOffset;
+		// Fraction of the first generated item that is scrolled off the top/left of the list view
+		return (CurrentScrollOffset - CachedItemLengths.GetOffsetOf(FirstItemIndex)) / CachedItemLengths.GetLength(FirstItemIndex);
 	}
 
 	/**
@@ -1561,7 +1681,7 @@ public:
 	void SetItemsSource(const TArray<ItemType>* InListItemsSource)
 	{
 		PRAGMA_DISABLE_DEPRECATION_WARNINGS
-		if (ItemsSource != InListItemsSource)
+		if (ItemsSource != InListItemsSource || DataSource.IsValid())
 		{
 			if (IsConstructed())
 			{
@@ -1571,10 +1691,53 @@ public:
 				RebuildList();
 			}
 			ItemsSource = InListItemsSource;
+			SetDataSourceInternal(nullptr);
+			ForgetItemLengthEstimate();
+			ItemIndices.Reset();
+			NumIndexedItems = 0;
+			SelectedRanges.Reset();
+			RangeSelectionStartIndex = INDEX_NONE;
+			bSelectionNeedsPruning = true;
 		}
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
 	}
 
+	/**
+	 * Observe items produced by a data source instead of an items array, only the items the list reads are made.
+	 * Item lengths are always estimated then, and only the items approaching the view or measured in the background are read.
+	 * Their lengths and selection are kept by position rather than by item.
+	 * Wipes all existing state and requests and will fully rebuild on the next tick, like SetItemsSource.
+	 */
+	void SetDataSource(const TSharedPtr<IDynamicListDataSource<ItemType>>& InDataSource)
+	{
+		PRAGMA_DISABLE_DEPRECATION_WARNINGS
+		if (DataSource != InDataSource || ItemsSource != nullptr)
+		{
+			if (IsConstructed())
+			{
+				Private_ClearSelection();
+				CancelScrollIntoView();
+				ClearWidgets();
+				RebuildList();
+			}
+			ItemsSource = nullptr;
+			SetDataSourceInternal(InDataSource);
+			ForgetItemLengthEstimate();
+			ItemIndices.Reset();
+			NumIndexedItems = 0;
+			SelectedRanges.Reset();
+			RangeSelectionStartIndex = INDEX_NONE;
+			bSelectionNeedsPruning = true;
+		}
+		PRAGMA_ENABLE_DEPRECATION_WARNINGS
+	}
+
+	/** @return The data source the list observes, null when it observes an items array. */
+	const TSharedPtr<IDynamicListDataSource<ItemType>>& GetDataSource() const
+	{
+		return DataSource;
+	}
+
 	UE_DEPRECATED(5.2, "SetListItemsSource is deprecated. Please use the correct SetItemsSource implementation.")
 	void SetListItemsSource(const TArray<ItemType>& InListItemsSource)
 	{
@@ -1584,21 +1747,231 @@ public:
 	bool HasValidItemsSource() const
 	{
 		PRAGMA_DISABLE_DEPRECATION_WARNINGS
-		return ItemsSource != nullptr;
+		return ItemsSource != nullptr || DataSource.IsValid();
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
 	}
 
-	TArrayView<const ItemType> GetItems() const
+	/** @return The items being observed, read from the items array or produced by the data source. */
+	TDynamicListItems<ItemType> GetItems() const
 	{
 		PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		if (ItemsSource)
 		{
-			return *ItemsSource;
+			return TDynamicListItems<ItemType>(TArrayView<const ItemType>(*ItemsSource));
+		}
+		if (DataSource.IsValid())
+		{
+			return TDynamicListItems<ItemType>(DataSource.Get());
 		}
-		return TArrayView<const ItemType>();
+		return TDynamicListItems<ItemType>();
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
 	}
 
+	/**
+	 * Find the index of an item in the items source in O(1), using an item to index map kept in sync with it.
+	 * Items appended since the last lookup are indexed as they are found, any other change to the items source is picked up after RequestListRefresh.
+	 * A data source that can find its items is asked directly instead, so that finding one does not make them all.
+	 *
+	 * @param Item  The item to look for.
+	 * @return The index of the first occurrence of the item, or INDEX_NONE if it is not in the items source.
+	 */
+	int32 GetIndexOfItem( const ItemType& Item ) const
+	{
+		const TDynamicListItems<ItemType> Items = GetItems();
+		if (Items.GetDataSource())
+		{
+			if (const TOptional<int32> IndexOfItem = Items.GetDataSource()->FindIndexOfItem(Item))
+			{
+				return IndexOfItem.GetValue();
+			}
+		}
+
+		if (NumIndexedItems > Items.Num())
+		{
+			// Items were removed without a refresh, start over
+			ItemIndices.Reset();
+			NumIndexedItems = 0;
+		}
+
+		for (; NumIndexedItems < Items.Num(); ++NumIndexedItems)
+		{
+			ItemIndices.FindOrAdd(Items[NumIndexedItems], NumIndexedItems);
+		}
+
+		const int32* IndexOfItem = ItemIndices.Find(Item);
+		if (IndexOfItem == nullptr)
+		{
+			return INDEX_NONE;
+		}
+
+		if (Items[*IndexOfItem] != Item)
+		{
+			// The items source was rearranged without a refresh, fall back to searching it and index it again next time
+			ItemIndices.Reset();
+			NumIndexedItems = 0;
+			return Items.Find(Item);
+		}
+
+		return *IndexOfItem;
+	}
+
+private:
+	/** Observe the given data source, following the items it refreshes */
+	void SetDataSourceInternal(const TSharedPtr<IDynamicListDataSource<ItemType>>& InDataSource)
+	{
+		if (DataSource.IsValid())
+		{
+			DataSource->OnItemsRefreshed().Remove(DataSourceItemsRefreshedHandle);
+			DataSource->OnItemsInserted().Remove(DataSourceItemsInsertedHandle);
+			DataSource->OnItemsRemoved().Remove(DataSourceItemsRemovedHandle);
+			DataSourceItemsRefreshedHandle.Reset();
+			DataSourceItemsInsertedHandle.Reset();
+			DataSourceItemsRemovedHandle.Reset();
+		}
+
+		DataSource = InDataSource;
+		if (DataSource.IsValid())
+		{
+			DataSourceItemsRefreshedHandle = DataSource->OnItemsRefreshed().AddSP(this, &SDynamicListView<ItemType>::HandleDataSourceItemsRefreshed);
+			DataSourceItemsInsertedHandle = DataSource->OnItemsInserted().AddSP(this, &SDynamicListView<ItemType>::NotifyItemsInserted);
+			DataSourceItemsRemovedHandle = DataSource->OnItemsRemoved().AddSP(this, &SDynamicListView<ItemType>::NotifyItemsRemoved);
+		}
+	}
+
+	/**
+	 * The data source swapped the items of entries that did not change: rows and lengths are redone.
+	 * The entries stay selected, their selection is held by index, so there is nothing to prune.
+	 */
+	void HandleDataSourceItemsRefreshed(int32 Index, int32 NumItems)
+	{
+		PatchItemIndicesForReplace(Index, NumItems);
+
+		SDynamicTableViewBase::NotifyItemsReplaced(Index, NumItems);
+	}
+
+	/** Items from the given index onwards changed places, drop their indices so that only they are indexed again */
+	void ForgetItemIndicesFrom(int32 Index)
+	{
+		// Appending to the indexed items does not move any of them
+		if (Index >= NumIndexedItems)
+		{
+			return;
+		}
+
+		if (Index <= 0)
+		{
+			ItemIndices.Reset();
+			NumIndexedItems = 0;
+			return;
+		}
+
+		for (auto IndexIt = ItemIndices.CreateIterator(); IndexIt; ++IndexIt)
+		{
+			if (IndexIt.Value() >= Index)
+			{
+				IndexIt.RemoveCurrent();
+			}
+		}
+		NumIndexedItems = Index;
+	}
+
+	/** Items were inserted at the given index: shift the indices of the items after them and index the new ones */
+	void PatchItemIndicesForInsert(int32 Index, int32 NumItems)
+	{
+		// Items inserted past the indexed ones are indexed when looked up
+		if (Index >= NumIndexedItems || NumItems <= 0)
+		{
+			return;
+		}
+
+		for (TPair<ItemType, int32>& ItemIndex : ItemIndices)
+		{
+			if (ItemIndex.Value >= Index)
+			{
+				ItemIndex.Value += NumItems;
+			}
+		}
+		NumIndexedItems += NumItems;
+
+		IndexItemRange(Index, Index + NumItems);
+	}
+
+	/** Items were removed from the given index: drop their indices and shift those of the items after them */
+	void PatchItemIndicesForRemove(int32 Index, int32 NumItems)
+	{
+		if (Index >= NumIndexedItems || NumItems <= 0)
+		{
+			return;
+		}
+
+		for (auto IndexIt = ItemIndices.CreateIterator(); IndexIt; ++IndexIt)
+		{
+			if (IndexIt.Value() >= Index + NumItems)
+			{
+				IndexIt.Value() -= NumItems;
+			}
+			else if (IndexIt.Value() >= Index)
+			{
+				IndexIt.RemoveCurrent();
+			}
+		}
+		NumIndexedItems = FMath::Max(NumIndexedItems - NumItems, Index);
+	}
+
+	/** Items were replaced from the given index: drop the indices of the previous ones and index the new ones */
+	void PatchItemIndicesForReplace(int32 Index, int32 NumItems)
+	{
+		if (Index >= NumIndexedItems || NumItems <= 0)
+		{
+			return;
+		}
+
+		const int32 EndIndex = FMath::Min(Index + NumItems, NumIndexedItems);
+		for (auto IndexIt = ItemIndices.CreateIterator(); IndexIt; ++IndexIt)
+		{
+			if (IndexIt.Value() >= Index && IndexIt.Value() < EndIndex)
+			{
+				IndexIt.RemoveCurrent();
+			}
+		}
+
+		IndexItemRange(Index, EndIndex);
+	}
+
+	/** Index the items in [StartIndex, EndIndex), which are among the indexed items, keeping the first occurrence of each */
+	void IndexItemRange(int32 StartIndex, int32 EndIndex)
+	{
+		const TDynamicListItems<ItemType> Items = GetItems();
+		for (int32 ItemIndex = StartIndex; ItemIndex < FMath::Min(EndIndex, Items.Num()); ++ItemIndex)
+		{
+			int32& IndexOfItem = ItemIndices.FindOrAdd(Items[ItemIndex], ItemIndex);
+			IndexOfItem = FMath::Min(IndexOfItem, ItemIndex);
+		}
+	}
+
+	bool IsItemInSelectedRanges( const ItemType& TheItem ) const
+	{
+		return !SelectedRanges.IsEmpty() && SelectedRanges.Contains( GetIndexOfItem( TheItem ) );
+	}
+
+	/** Select the items from First to Last included as a single range, however many they are */
+	void SelectItemRange( int32 First, int32 Last )
+	{
+		// Items in the range must not also be in the selected item set
+		for ( auto SelectedItemIt = SelectedItems.CreateIterator(); SelectedItemIt; ++SelectedItemIt )
+		{
+			const int32 ItemIndex = GetIndexOfItem( *SelectedItemIt );
+			if ( ItemIndex >= First && ItemIndex <= Last )
+			{
+				SelectedItemIt.RemoveCurrent();
+			}
+		}
+
+		SelectedRanges.Add( First, Last );
+	}
+
+public:
+
 	/**
 	 * Given a Widget, find the corresponding data item.
 	 * 
@@ -1680,7 +2053,7 @@ public:
 			return;
 		}
 
-		if ( SelectedItems.Num() == 0 )
+		if ( GetNumItemsSelected() == 0 )
 		{
 			return;
 		}
@@ -1717,13 +2090,122 @@ public:
 	 */
 	int32 GetNumItemsSelected() const
 	{
-		return SelectedItems.Num();
+		return SelectedItems.Num() + SelectedRanges.Num();
+	}
+
+	/**
+	 * Gets the first selected item, without gathering all of them like GetSelectedItems does.
+	 *
+	 * @return The first selected item, or null if nothing is selected.
+	 */
+	NullableItemType GetFirstSelectedItem() const
+	{
+		if ( SelectedItems.Num() > 0 )
+		{
+			return *typename TItemSet::TConstIterator( SelectedItems );
+		}
+
+		const TDynamicListItems<ItemType> Items = GetItems();
+		if ( !SelectedRanges.IsEmpty() && Items.IsValidIndex( SelectedRanges.GetRanges()[0].Min ) )
+		{
+			return Items[SelectedRanges.GetRanges()[0].Min];
+		}
+
+		return TListTypeTraits< ItemType >::MakeNullPtr();
+	}
+
+	virtual void RequestListRefresh() override
+	{
+		// The items source may have changed in any way
+		ItemIndices.Reset();
+		NumIndexedItems = 0;
+		bSelectionNeedsPruning = true;
+
+		// Selected ranges are indices, which may now point at other items, e.g. after a sort: the selection they hold is dropped and signaled
+		if ( !SelectedRanges.IsEmpty() )
+		{
+			SelectedRanges.Reset();
+			bSelectedRangesLostItems = true;
+		}
+		RangeSelectionStartIndex = INDEX_NONE;
+
+		SDynamicTableViewBase::RequestListRefresh();
+	}
+
+	virtual void NotifyItemsInserted(int32 Index, int32 NumItems) override
+	{
+		PatchItemIndicesForInsert(Index, NumItems);
+		SelectedRanges.Insert(Index, NumItems);
+		if (RangeSelectionStartIndex >= Index)
+		{
+			RangeSelectionStartIndex += NumItems;
+		}
+		SDynamicTableViewBase::NotifyItemsInserted(Index, NumItems);
+	}
+
+	virtual void NotifyItemsRemoved(int32 Index, int32 NumItems) override
+	{
+		PatchItemIndicesForRemove(Index, NumItems);
+		bSelectionNeedsPruning = true;
+
+		const int32 NumSelectedInRanges = SelectedRanges.Num();
+		SelectedRanges.RemoveAt(Index, NumItems);
+		bSelectedRangesLostItems |= SelectedRanges.Num() != NumSelectedInRanges;
+
+		if (RangeSelectionStartIndex >= Index)
+		{
+			RangeSelectionStartIndex = RangeSelectionStartIndex >= Index + NumItems ? RangeSelectionStartIndex - NumItems : INDEX_NONE;
+		}
+
+		SDynamicTableViewBase::NotifyItemsRemoved(Index, NumItems);
+	}
+
+	virtual void NotifyItemsMoved(int32 FromIndex, int32 NumItems, int32 ToIndex) override
+	{
+		ForgetItemIndicesFrom(FMath::Min(FromIndex, ToIndex));
+		SelectedRanges.Move(FromIndex, NumItems, ToIndex);
+		RangeSelectionStartIndex = INDEX_NONE;
+		SDynamicTableViewBase::NotifyItemsMoved(FromIndex, NumItems, ToIndex);
+	}
+
+	virtual void NotifyItemsReplaced(int32 Index, int32 NumItems) override
+	{
+		PatchItemIndicesForReplace(Index, NumItems);
+		bSelectionNeedsPruning = true;
+
+		// The replaced items left the items source, the new ones are not selected
+		const int32 NumSelectedInRanges = SelectedRanges.Num();
+		SelectedRanges.Remove(Index, Index + NumItems - 1);
+		bSelectedRangesLostItems |= SelectedRanges.Num() != NumSelectedInRanges;
+
+		if (RangeSelectionStartIndex >= Index && RangeSelectionStartIndex < Index + NumItems)
+		{
+			RangeSelectionStartIndex = INDEX_NONE;
+		}
+
+		SDynamicTableViewBase::NotifyItemsReplaced(Index, NumItems);
+	}
+
+	virtual void NotifyItemsReordered(TArrayView<const int32> PreviousIndices) override
+	{
+		ForgetItemIndicesFrom(0);
+		bSelectionNeedsPruning = true;
+
+		const int32 NumSelectedInRanges = SelectedRanges.Num();
+		SelectedRanges.Remap(PreviousIndices);
+		bSelectedRangesLostItems |= SelectedRanges.Num() != NumSelectedInRanges;
+		RangeSelectionStartIndex = INDEX_NONE;
+
+		SDynamicTableViewBase::NotifyItemsReordered(PreviousIndices);
 	}
 
 	virtual void RebuildList() override
 	{
 		WidgetGenerator.Clear();
 		PinnedWidgetGenerator.Clear();
+		ItemLengthCache.Reset();
+		MeasurementRowsByEntryClass.Reset();
+		ForgetItemLengthEstimate();
 		RequestListRefresh();
 	}
 
@@ -1735,22 +2217,28 @@ public:
 	virtual TArray< ItemType > GetSelectedItems() const override
 	{
 		TArray< ItemType > SelectedItemArray;
-		SelectedItemArray.Empty( SelectedItems.Num() );
-		for( typename TItemSet::TConstIterator SelectedItemIt( SelectedItems ); SelectedItemIt; ++SelectedItemIt )
-		{
-			SelectedItemArray.Add( *SelectedItemIt );
-		}
+		GetSelectedItems( SelectedItemArray );
 		return SelectedItemArray;
 	}
 
 	int32 GetSelectedItems(TArray< ItemType >& SelectedItemArray) const
 	{
-		SelectedItemArray.Empty(SelectedItems.Num());
+		SelectedItemArray.Empty(GetNumItemsSelected());
 		for (typename TItemSet::TConstIterator SelectedItemIt(SelectedItems); SelectedItemIt; ++SelectedItemIt)
 		{
 			SelectedItemArray.Add(*SelectedItemIt);
 		}
-		return SelectedItems.Num();
+
+		// Items selected in bulk are only gathered here, when someone asks for them
+		const TDynamicListItems<ItemType> Items = GetItems();
+		for (const FInt32Interval& SelectedRange : SelectedRanges.GetRanges())
+		{
+			for (int32 ItemIndex = SelectedRange.Min; ItemIndex <= FMath::Min(SelectedRange.Max, Items.Num() - 1); ++ItemIndex)
+			{
+				SelectedItemArray.Add(Items[ItemIndex]);
+			}
+		}
+		return SelectedItemArray.Num();
 	}
 
 	/**
@@ -1774,9 +2262,40 @@ public:
 	{
 		ItemToScrollIntoView = ItemToView; 
 		UserRequestingScrollIntoView = UserIndex;
+		ScrollIntoViewAlignment.Reset();
 		RequestLayoutRefresh();
 	}
 
+	/**
+	 * Scroll an item into view, aligned with the view as requested. If the item is not found, fails silently.
+	 * The scroll offset is computed from the measured item lengths, so the item lands in place on the next tick (or at the end of the scroll animation).
+	 *
+	 * @param ItemToView  The item to scroll into view on next tick.
+	 * @param Alignment   IntoView scrolls as little as possible to show the whole item, the others align it with the start, center or end of the view.
+	 * @param Padding     Space left between the item and the edge of the view it is brought next to, ignored when centering.
+	 */
+	void RequestScrollIntoView( ItemType ItemToView, EDescendantScrollDestination Alignment, float Padding = 0.f, const uint32 UserIndex = 0 )
+	{
+		RequestScrollIntoView(ItemToView, UserIndex);
+		ScrollIntoViewAlignment = Alignment;
+		ScrollIntoViewPadding = Padding;
+	}
+
+	/**
+	 * Measure the length of a single item again on next tick, e.g. after its content changed, without re-measuring the whole list.
+	 * If the item is not found, fails silently.
+	 *
+	 * @param Item  The item whose entry length changed.
+	 */
+	void InvalidateItemLength( const ItemType& Item )
+	{
+		const int32 IndexOfItem = GetIndexOfItem(Item);
+		if (IndexOfItem != INDEX_NONE)
+		{
+			InvalidateItemLengthRange(IndexOfItem, 1);
+		}
+	}
+
 	UE_DEPRECATED(4.20, "RequestScrollIntoView no longer takes parameter bNavigateOnScrollIntoView. Call RequestNavigateToItem instead of RequestScrollIntoView if navigation is required.")
 	void RequestScrollIntoView(ItemType ItemToView, const uint32 UserIndex, const bool NavigateOnScrollIntoView)
 	{
@@ -1820,6 +2339,7 @@ public:
 	{
 		UserRequestingScrollIntoView = 0;
 		bNavigateOnScrollIntoView = false;
+		ScrollIntoViewAlignment.Reset();
 		TListTypeTraits<ItemType>::ResetPtr(ItemToScrollIntoView);
 	}
 
@@ -1866,9 +2386,9 @@ public:
 			else if (PreviousMode == ESelectionMode::Multi)
 			{
 				// We've gone to a single-selection mode, so if we already had a single item selected, preserve it
-				if (SelectedItems.Num() == 1)
+				if (GetNumItemsSelected() == 1)
 				{
-					SetSelection(*SelectedItems.CreateIterator());
+					SetSelection(TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType(GetFirstSelectedItem()));
 				}
 				else
 				{
@@ -1952,95 +2472,93 @@ protected:
 	{
 		if (HasValidItemsSource() && TListTypeTraits<ItemType>::IsPtrValid(ItemToScrollIntoView))
 		{
-			const TArrayView<const ItemType> Items = GetItems();
-			const int32 IndexOfItem = Items.Find( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( ItemToScrollIntoView ) );
+			const TDynamicListItems<ItemType> Items = GetItems();
+			const int32 IndexOfItem = GetIndexOfItem( TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType( ItemToScrollIntoView ) );
 			if (IndexOfItem != INDEX_NONE)
 			{
-				double NumLiveWidgets = GetNumLiveWidgets();
-				if (NumLiveWidgets == 0. && IsPendingRefresh())
+				const double ViewLength = FTableViewDimensions(this->Orientation, ListViewGeometry.GetLocalSize()).ScrollAxis;
+				if (!CachedItemLengths.IsValidIndex(IndexOfItem) || ViewLength <= 0.)
 				{
-					// Use the last number of widgets on screen to estimate if we actually need to scroll.
-					NumLiveWidgets = LastGenerateResults.ExactNumLinesOnScreen;
-
-					// If we still don't have any widgets, we're not in a situation where we can scroll an item into view
-					// (probably as nothing has been generated yet), so we'll defer this again until the next frame
-					if (NumLiveWidgets == 0)
-					{
-						return EScrollIntoViewResult::Deferred;
-					}
+					// The item has not been measured yet or we have no geometry to scroll within,
+					// so we'll defer this again until the next frame
+					return EScrollIntoViewResult::Deferred;
 				}
 
 				EndInertialScrolling();
-				
-				const int32 NumFullEntriesInView = (int32)(FMath::FloorToDouble(CurrentScrollOffset + NumLiveWidgets) - FMath::CeilToDouble(CurrentScrollOffset));
+
+				// The items sharing the view with the item must have their real length for its offset to hold once they are generated
+				MeasureItemsAround(IndexOfItem, ViewLength);
+
+				const double ItemStart = CachedItemLengths.GetOffsetOf(IndexOfItem);
+				const double ItemEnd = ItemStart + CachedItemLengths.GetLength(IndexOfItem);
+				const double MaxScrollOffset = FMath::Max(0.0, GetTotalItemsLength() - ViewLength);
 
 				// Only scroll the item into view if it's not already in the visible range
-				// When navigating, we don't want to scroll partially visible existing rows all the way to the center, so we count partially displayed indices in the displayed range
-				const double MinDisplayedIndex = bNavigateOnScrollIntoView ? FMath::FloorToDouble(CurrentScrollOffset) : FMath::CeilToDouble(CurrentScrollOffset);
-				const double MaxDisplayedIndex = bNavigateOnScrollIntoView ? FMath::CeilToDouble(CurrentScrollOffset + NumFullEntriesInView) : FMath::FloorToDouble(CurrentScrollOffset + NumFullEntriesInView);
-				if (IndexOfItem < MinDisplayedIndex || IndexOfItem > MaxDisplayedIndex)
+				// When navigating, we don't want to scroll partially visible existing rows all the way to the center, so we count partially displayed items as displayed
+				const bool bIsDisplayed = bNavigateOnScrollIntoView
+					? ItemEnd > CurrentScrollOffset && ItemStart < CurrentScrollOffset + ViewLength
+					: ItemStart >= CurrentScrollOffset && ItemEnd <= CurrentScrollOffset + ViewLength;
+				if (ScrollIntoViewAlignment.IsSet())
 				{
-					// Scroll the top of the listview to the item in question
-					double NewScrollOffset = IndexOfItem;
+					TOptional<double> NewScrollOffset;
+					switch (ScrollIntoViewAlignment.GetValue())
+					{
+					case EDescendantScrollDestination::TopOrLeft:
+						NewScrollOffset = ItemStart - ScrollIntoViewPadding;
+						break;
+					case EDescendantScrollDestination::Center:
+						NewScrollOffset = (ItemStart + ItemEnd - ViewLength) / 2.0;
+						break;
+					case EDescendantScrollDestination::BottomOrRight:
+						NewScrollOffset = ItemEnd + ScrollIntoViewPadding - ViewLength;
+						break;
+					case EDescendantScrollDestination::IntoView:
+					default:
+						// Scroll the least to bring the whole item and its padding into view, favoring its start when it does not fit
+						if (ItemStart - ScrollIntoViewPadding < CurrentScrollOffset)
+						{
+							NewScrollOffset = ItemStart - ScrollIntoViewPadding;
+						}
+						else if (ItemEnd + ScrollIntoViewPadding > CurrentScrollOffset + ViewLength)
+						{
+							NewScrollOffset = FMath::Min(ItemEnd + ScrollIntoViewPadding - ViewLength, ItemStart - ScrollIntoViewPadding);
+						}
+						break;
+					}
 
+					if (NewScrollOffset.IsSet())
+					{
+						SetScrollOffset(FMath::Clamp<double>(NewScrollOffset.GetValue(), 0.0, MaxScrollOffset));
+					}
+				}
+				else if (!bIsDisplayed)
+				{
 					// Center the list view on the item in question.
-					NewScrollOffset -= (NumLiveWidgets / 2.0);
+					double NewScrollOffset = (ItemStart + ItemEnd - ViewLength) / 2.0;
 
 					// Limit offset to top and bottom of the list.
-					const double MaxScrollOffset = FMath::Max(0.0, static_cast<double>(Items.Num()) - NumLiveWidgets);
 					NewScrollOffset = FMath::Clamp<double>(NewScrollOffset, 0.0, MaxScrollOffset);
 
-					SetScrollOffset((float)NewScrollOffset);
+					SetScrollOffset(NewScrollOffset);
 				}
 				else if (bNavigateOnScrollIntoView)
 				{
-					if (TSharedPtr<ITableRow> TableRow = WidgetFromItem(Items[IndexOfItem]))
+					double NewScrollOffset = DesiredScrollOffset;
+					// Make sure the existing entry for this item is fully in view
+					if (ItemStart < CurrentScrollOffset)
 					{
-						const FGeometry& WidgetGeometry = TableRow->AsWidget()->GetCachedGeometry();
-						const FTableViewDimensions WidgetTopLeft(this->Orientation, WidgetGeometry.GetAbsolutePositionAtCoordinates(FVector2D::ZeroVector));
-						const FTableViewDimensions ListViewTopLeft(this->Orientation, ListViewGeometry.GetAbsolutePositionAtCoordinates(FVector2D::ZeroVector));
-
-						double NewScrollOffset = DesiredScrollOffset;
-						// Make sure the existing entry for this item is fully in view
-						if (WidgetTopLeft.ScrollAxis < ListViewTopLeft.ScrollAxis)
-						{
-							// This entry is clipped at the top/left, so simply set it as the new scroll offset target to bump it down into view
-							NewScrollOffset = static_cast<double>(IndexOfItem - NavigationScrollOffset);
-						}
-						else
-						{
-							const FVector2D BottomRight(1.f, 1.f);
-							const FTableViewDimensions WidgetBottomRight(this->Orientation, WidgetGeometry.GetAbsolutePositionAtCoordinates(BottomRight));
-							const FTableViewDimensions ListViewBottomRight(this->Orientation, ListViewGeometry.GetAbsolutePositionAtCoordinates(BottomRight));
-							
-							if (WidgetBottomRight.ScrollAxis > ListViewBottomRight.ScrollAxis)
-							{
-								// This entry is clipped at the end, so we need to determine the exact item offset required to get it fully into view
-								// To do so, we need to push the current offset down by the clipped amount translated into number of items
-								float DistanceRemaining = WidgetBottomRight.ScrollAxis - ListViewBottomRight.ScrollAxis;
-								float AdditionalOffset = 0.f;
-								for (const ItemType& ItemWithWidget : WidgetGenerator.ItemsWithGeneratedWidgets)
-								{
-									FTableViewDimensions WidgetAbsoluteDimensions(this->Orientation, WidgetGenerator.GetWidgetForItem(ItemWithWidget)->AsWidget()->GetCachedGeometry().GetAbsoluteSize());
-									if (WidgetAbsoluteDimensions.ScrollAxis < DistanceRemaining)
-									{
-										DistanceRemaining -= WidgetAbsoluteDimensions.ScrollAxis;
-										AdditionalOffset += 1.f;
-									}
-									else
-									{
-										AdditionalOffset += DistanceRemaining / WidgetAbsoluteDimensions.ScrollAxis;
-										DistanceRemaining = 0.f;
-										break;
-									}
-								}
-
-								NewScrollOffset = DesiredScrollOffset + AdditionalOffset + (FixedLineScrollOffset.IsSet() ? 0.f : NavigationScrollOffset);
-							}
-						}
-
-						SetScrollOffset((float)NewScrollOffset);
+						// This entry is clipped at the top/left, so bump it down into view along with some of the preceding item
+						const float PrecedingItemLength = IndexOfItem > 0 ? CachedItemLengths.GetLength(IndexOfItem - 1) : 0.f;
+						NewScrollOffset = ItemStart - NavigationScrollOffset * PrecedingItemLength;
 					}
+					else if (ItemEnd > CurrentScrollOffset + ViewLength)
+					{
+						// This entry is clipped at the end, so push the offset down by the clipped amount along with some of the following item
+						const float FollowingItemLength = CachedItemLengths.IsValidIndex(IndexOfItem + 1) ? CachedItemLengths.GetLength(IndexOfItem + 1) : 0.f;
+						NewScrollOffset = ItemEnd - ViewLength + (FixedLineScrollOffset.IsSet() ? 0.f : NavigationScrollOffset * FollowingItemLength);
+					}
+
+					SetScrollOffset(FMath::Clamp<double>(NewScrollOffset, 0.0, MaxScrollOffset));
 				}
 
 				RequestLayoutRefresh();
@@ -2142,7 +2660,7 @@ protected:
 			//           Scroll "one widget's length" at a time until we've scrolled as far as the user asked us to.
 			//           Generate widgets on demand so we can figure out how big they are.
 	
-			const TArrayView<const ItemType> Items = GetItems();
+			const TDynamicListItems<ItemType> Items = GetItems();
 			if (Items.Num() > 0)
 			{
 				int32 ItemIndex = StartingItemIndex;
@@ -2260,7 +2778,7 @@ protected:
 		if (OnIsSelectableOrNavigable.IsBound())
 		{
 			// Walk through the list until we either find a navigable item or run out of entries.
-			const TArrayView<const ItemType> Items = GetItems();
+			const TDynamicListItems<ItemType> Items = GetItems();
 			while (!OnIsSelectableOrNavigable.Execute(ItemToSelect))
 			{
 				SelectionIdx += (bSelectForward ? 1 : -1);
@@ -2287,19 +2805,19 @@ protected:
 		{
 			if (!OnIsSelectableOrNavigable.Execute(ItemToSelect))
 			{
-				const TArrayView<const ItemType> Items = GetItems();
-				int32 NewSelectionIdx = Items.Find(ItemToSelect);
+				const TDynamicListItems<ItemType> Items = GetItems();
+				int32 NewSelectionIdx = GetIndexOfItem(ItemToSelect);
 
 				// By default, we walk forward
 				bool bSelectNextItem = true;
-				if (SelectedItems.Num() == 1)
+				if (GetNumItemsSelected() == 1)
 				{
 					// If the last selected item is after the item to select, we'll want to walk backwards
-					NullableItemType LastSelectedItem = *SelectedItems.CreateIterator();
+					NullableItemType LastSelectedItem = GetFirstSelectedItem();
 					if (TListTypeTraits<ItemType>::IsPtrValid(LastSelectedItem))
 					{
 						ItemType NonNullLastSelectedItem = TListTypeTraits<ItemType>::NullableItemTypeConvertToItemType(LastSelectedItem);
-						const int32 LastSelectedItemIdx = Items.Find(NonNullLastSelectedItem);
+						const int32 LastSelectedItemIdx = GetIndexOfItem(NonNullLastSelectedItem);
 
 						bSelectNextItem = LastSelectedItemIdx < NewSelectionIdx;
 					}
@@ -2375,35 +2893,202 @@ protected:
 
 	virtual void ComputeTotalItemsLength(float LayoutScaleMultiplier) override
 	{
-		TotalItemsLength = 0.f;
-		CachedItemLengths.Empty();
-		
-		TSharedPtr<SObjectDynamicTableRow<ItemType>> RowWidget = StaticCastSharedPtr<SObjectDynamicTableRow<ItemType>>(GenerateNewWidget(nullptr).ToSharedPtr());
-		if (!RowWidget.IsValid())
+		const TDynamicListItems<ItemType> Items = GetItems();
+		ResetItemLengths(Items.Num());
+		ItemLengthCache.PurgeExpired();
+
+		MeasureItemRange(0, Items.Num(), LayoutScaleMultiplier);
+	}
+
+	virtual void ComputeItemLengthRange(int32 StartIndex, int32 NumItems, float LayoutScaleMultiplier) override
+	{
+		const TDynamicListItems<ItemType> Items = GetItems();
+		const int32 EndIndex = FMath::Min(StartIndex + NumItems, Items.Num());
+		if (StartIndex < 0 || StartIndex >= EndIndex || StartIndex > CachedItemLengths.Num())
 		{
 			return;
 		}
-		
-		for (ItemType CurItem : GetItems())
+
+		MeasureItemRange(StartIndex, EndIndex, LayoutScaleMultiplier);
+	}
+
+	virtual TOptional<float> FindCachedItemLength(int32 ItemIndex, float LayoutScaleMultiplier) const override
+	{
+		const TDynamicListItems<ItemType> Items = GetItems();
+		if (!Items.IsValidIndex(ItemIndex))
 		{
-			RowWidget->InitializeObjectRow_DynamicInternal(CurItem);
-			Private_OnEntryInitialized(CurItem, RowWidget.ToSharedRef());
-			
-			const TSharedRef<SWidget> NewlyGeneratedWidget = RowWidget->AsWidget();
-			NewlyGeneratedWidget->MarkPrepassAsDirty();
-			NewlyGeneratedWidget->SlatePrepass(LayoutScaleMultiplier);
-	
-			const bool bIsVisible = NewlyGeneratedWidget->GetVisibility().IsVisible();
-			FTableViewDimensions GeneratedWidgetDimensions(Orientation, bIsVisible ? NewlyGeneratedWidget->GetDesiredSize() : FVector2D::ZeroVector);
-	
-			TotalItemsLength += GeneratedWidgetDimensions.ScrollAxis;
-			CachedItemLengths.Add(GeneratedWidgetDimensions.ScrollAxis);
+			return TOptional<float>();
+		}
+
+		const TOptional<float> ItemLength = GetKnownItemLength(ItemIndex);
+		if (ItemLength.IsSet() || Items.GetDataSource())
+		{
+			return ItemLength;
+		}
+		return ItemLengthCache.Find(Items[ItemIndex], MakeItemLengthContext(GetMeasurementEntryClass(Items[ItemIndex]), LayoutScaleMultiplier));
+	}
+
+	virtual void DiscardCachedItemLengths(int32 StartIndex, int32 NumItems) override
+	{
+		const TDynamicListItems<ItemType> Items = GetItems();
+		for (int32 ItemIndex = FMath::Max(StartIndex, 0); ItemIndex < FMath::Min(StartIndex + NumItems, Items.Num()); ++ItemIndex)
+		{
+			ItemLengthCache.Remove(Items[ItemIndex]);
+			WidgetGenerator.InvalidatePrepass(Items[ItemIndex]);
+		}
+	}
+
+	/**
+	 * Measure the items in [StartIndex, EndIndex) whose length is neither known from the data nor cached, and store all their lengths in order.
+	 * Items are grouped by entry class, so that each class's measurement row is re-bound and prepassed in tight sequence.
+	 * Stops at the first item that could not be measured, so that the stored lengths stay contiguous.
+	 */
+	void MeasureItemRange(int32 StartIndex, int32 EndIndex, float LayoutScaleMultiplier)
+	{
+		const TDynamicListItems<ItemType> Items = GetItems();
+
+		// Lengths are kept for up to twice the items listed, so that items coming back from another source still find theirs
+		ItemLengthCache.SetMaxNum(FMath::Max(FMath::Min(Items.Num(), MAX_int32 / 2) * 2, 1024));
+
+		if (OnGetItemLength.IsBound() || Items.GetDataSource())
+		{
+			// Lengths known from the data alone are stored straight away, only fall back to widgets from the first item without one
+			for (; StartIndex < EndIndex; ++StartIndex)
+			{
+				const TOptional<float> ItemLength = GetKnownItemLength(StartIndex);
+				if (!ItemLength.IsSet())
+				{
+					break;
+				}
+				SetMeasuredItemLength(StartIndex, ItemLength.GetValue());
+			}
+
+			if (StartIndex == EndIndex)
+			{
+				return;
+			}
+		}
+
+		TArray<TOptional<float>> ItemLengths;
+		ItemLengths.SetNum(EndIndex - StartIndex);
+
+		// Indices of the items that need measuring, by the entry class they are measured with
+		TMap<FObjectKey, TArray<int32>> ItemsToMeasureByEntryClass;
+		for (int32 ItemIndex = StartIndex; ItemIndex < EndIndex; ++ItemIndex)
+		{
+			ItemLengths[ItemIndex - StartIndex] = GetKnownItemLength(ItemIndex);
+			if (ItemLengths[ItemIndex - StartIndex].IsSet())
+			{
+				continue;
+			}
+
+			const ItemType Item = Items[ItemIndex];
+
+			// Data sources may make any number of items, their lengths are only kept by position
+			const FObjectKey EntryClass = GetMeasurementEntryClass(Item);
+			if (!Items.GetDataSource())
+			{
+				ItemLengths[ItemIndex - StartIndex] = ItemLengthCache.Find(Item, MakeItemLengthContext(EntryClass, LayoutScaleMultiplier));
+			}
+			if (!ItemLengths[ItemIndex - StartIndex].IsSet())
+			{
+				ItemsToMeasureByEntryClass.FindOrAdd(EntryClass).Add(ItemIndex);
+			}
+		}
+
+		for (const TPair<FObjectKey, TArray<int32>>& EntryClassItems : ItemsToMeasureByEntryClass)
+		{
+			const TSharedPtr<SObjectDynamicTableRow<ItemType>> RowWidget = FindOrCreateMeasurementRow(EntryClassItems.Key, Items[EntryClassItems.Value[0]]);
+			if (!RowWidget.IsValid())
+			{
+				continue;
+			}
+
+			const FDynamicListItemLengthContext Context = MakeItemLengthContext(EntryClassItems.Key, LayoutScaleMultiplier);
+			for (const int32 ItemIndex : EntryClassItems.Value)
+			{
+				const float ItemLength = MeasureItemLength(RowWidget.ToSharedRef(), Items[ItemIndex], LayoutScaleMultiplier);
+				if (!Items.GetDataSource())
+				{
+					ItemLengthCache.Add(Items[ItemIndex], Context, ItemLength);
+				}
+				ItemLengths[ItemIndex - StartIndex] = ItemLength;
+			}
+		}
+
+		for (int32 ItemIndex = StartIndex; ItemIndex < EndIndex; ++ItemIndex)
+		{
+			if (!ItemLengths[ItemIndex - StartIndex].IsSet())
+			{
+				return;
+			}
+			SetMeasuredItemLength(ItemIndex, ItemLengths[ItemIndex - StartIndex].GetValue());
 		}
 	}
 
-	virtual double GetTotalItemsLength() const override
+	/** @return The entry class the given item is measured with, or a null key when all items share the same row */
+	FObjectKey GetMeasurementEntryClass(const ItemType& Item) const
 	{
-		return TotalItemsLength;
+		return OnGetEntryClassForItem.IsBound() ? FObjectKey(OnGetEntryClassForItem.Execute(Item).Get()) : FObjectKey();
+	}
+
+	/** @return The context item lengths are currently measured in, which cached lengths must match to be reused */
+	FDynamicListItemLengthContext MakeItemLengthContext(const FObjectKey& EntryClass, float LayoutScaleMultiplier) const
+	{
+		FDynamicListItemLengthContext Context;
+		Context.EntryClass = EntryClass;
+		Context.LayoutScaleMultiplier = LayoutScaleMultiplier;
+		Context.LineAxisLength = GetMeasuredLineAxisLength();
+		return Context;
+	}
+
+	/** @return The row reused to measure every item of the given entry class, generated from the given item the first time */
+	TSharedPtr<SObjectDynamicTableRow<ItemType>> FindOrCreateMeasurementRow(const FObjectKey& EntryClass, const ItemType& SampleItem)
+	{
+		TSharedPtr<SObjectDynamicTableRow<ItemType>>& RowWidget = MeasurementRowsByEntryClass.FindOrAdd(EntryClass);
+		if (!RowWidget.IsValid() || !RowWidget->GetUserWidget())
+		{
+			RowWidget = StaticCastSharedPtr<SObjectDynamicTableRow<ItemType>>(GenerateNewWidget(SampleItem).ToSharedPtr());
+		}
+		return RowWidget;
+	}
+
+	/** Forget the lengths of the items that were garbage collected */
+	void PurgeExpiredItemLengths()
+	{
+		ItemLengthCache.PurgeExpired();
+	}
+
+	/**
+	 * @return The length of an item known from the data alone, given by the data source or OnGetItemLength, unset if it has to be measured.
+	 * The item is only read when OnGetItemLength needs it, so that a data source's length hint spares making it.
+	 */
+	TOptional<float> GetKnownItemLength(int32 ItemIndex) const
+	{
+		if (DataSource.IsValid())
+		{
+			const TOptional<float> LengthHint = DataSource->GetItemLengthHint(ItemIndex);
+			if (LengthHint.IsSet())
+			{
+				return LengthHint;
+			}
+		}
+		return OnGetItemLength.IsBound() ? OnGetItemLength.Execute(GetItems()[ItemIndex]) : TOptional<float>();
+	}
+
+	/** Initialize the measurement row with the given item and return the length it desires along the scroll axis */
+	float MeasureItemLength(const TSharedRef<SObjectDynamicTableRow<ItemType>>& RowWidget, ItemType CurItem, float LayoutScaleMultiplier)
+	{
+		RowWidget->InitializeObjectRow_DynamicInternal(CurItem);
+		Private_OnEntryInitialized(CurItem, RowWidget);
+		
+		const TSharedRef<SWidget> NewlyGeneratedWidget = RowWidget->AsWidget();
+		NewlyGeneratedWidget->MarkPrepassAsDirty();
+		NewlyGeneratedWidget->SlatePrepass(LayoutScaleMultiplier);
+
+		const bool bIsVisible = NewlyGeneratedWidget->GetVisibility().IsVisible();
+		FTableViewDimensions GeneratedWidgetDimensions(Orientation, bIsVisible ? NewlyGeneratedWidget->GetDesiredSize() : FVector2D::ZeroVector);
+		return GeneratedWidgetDimensions.ScrollAxis;
 	}
 
 protected:
@@ -2446,6 +3131,9 @@ protected:
 	/** The item which was last manipulated; used as a start for shift-click selection */
 	NullableItemType RangeSelectionStart;
 
+	/** Index of RangeSelectionStart when the list observes a data source, whose items may be made again or swapped for others. INDEX_NONE otherwise. */
+	int32 RangeSelectionStartIndex = INDEX_NONE;
+
 	/** A set of which items should be highlighted */
 	TItemSet HighlightedItems;
 
@@ -2453,12 +3141,26 @@ protected:
 	/** Pointer to the array of data items that we are observing */
 	const TArray<ItemType>* ItemsSource;
 
+	/** Produces the data items we are observing when the list does not observe an array */
+	TSharedPtr<IDynamicListDataSource<ItemType>> DataSource;
+
+	/** Our binding to the data source's OnItemsRefreshed */
+	FDelegateHandle DataSourceItemsRefreshedHandle;
+	FDelegateHandle DataSourceItemsInsertedHandle;
+	FDelegateHandle DataSourceItemsRemovedHandle;
+
 	/** When not null, the list will try to scroll to this item on tick. */
 	NullableItemType ItemToScrollIntoView;
 
 	/** The user index requesting the item to be scrolled into view. */
 	uint32 UserRequestingScrollIntoView;
 
+	/** Where the item to scroll into view should end up, centered when not already in view if unset */
+	TOptional<EDescendantScrollDestination> ScrollIntoViewAlignment;
+
+	/** Space to leave between the item to scroll into view and the edge of the view it is aligned with */
+	float ScrollIntoViewPadding = 0.f;
+
 	/** When set, the list will notify this item when it has been scrolled into view */
 	NullableItemType ItemToNotifyWhenInView;
 
@@ -2477,6 +3179,38 @@ protected:
 	/** True when the list view supports keyboard focus */
 	TAttribute<bool> IsFocusable;
 
+	/** Measured item lengths keyed by item, reused when items come back in a different position or a different items source */
+	TDynamicListItemLengthCache<ItemType> ItemLengthCache;
+
+	/** Index of the first occurrence of each of the first NumIndexedItems items of the items source, see GetIndexOfItem */
+	mutable TMap< ItemType, int32, FDefaultSetAllocator, MapKeyFuncs > ItemIndices;
+	mutable int32 NumIndexedItems = 0;
+
+	/** True when items may have left the items source since the selection was last pruned, see UpdateSelectionSet */
+	bool bSelectionNeedsPruning = true;
+
+	/** Number of items in the items source when the selection was last pruned */
+	int32 NumItemsWhenSelectionPruned = 0;
+
+	/**
+	 * Items selected in bulk (select all, shift-click ranges), as ranges of indices into the items source.
+	 * They follow the items through the NotifyItems* notifications and are dropped by RequestListRefresh, which does not say where the items went.
+	 * An item is never both in a range and in SelectedItems.
+	 */
+	FDynamicListSelectionRanges SelectedRanges;
+
+	/** True when selected ranges lost items since the selection was last pruned, so that the change gets signaled */
+	bool bSelectedRangesLostItems = false;
+
+	/** Delegate to be invoked to know which entry class an item is displayed, and therefore measured, with. */
+	FOnGetEntryClassForItem OnGetEntryClassForItem;
+
+	/** Delegate to be invoked for the length of an item known without measuring its widget. */
+	FOnGetItemLength OnGetItemLength;
+
+	/** One reusable row per entry class to measure items with */
+	TMap<FObjectKey, TSharedPtr<SObjectDynamicTableRow<ItemType>>> MeasurementRowsByEntryClass;
+
 	/** The additional scroll offset (in items) to show when navigating to rows at the edge of the visible area (i.e. how much of the following item(s) to show) */
 	float NavigationScrollOffset = 0.5f;
 
@@ -2509,12 +3243,6 @@ protected:
 	
 	/** If true, number of pinned items > MaxPinnedItems so some items are collapsed in the hierarchy */
 	bool bIsHierarchyCollapsed = false;
-	
-	/** Container for, Item to Widget length cache */
-	TArray<float> CachedItemLengths;
-	
-	/** The length of all item */
-	double TotalItemsLength;
 
 private:
 	struct FGenerationPassGuard
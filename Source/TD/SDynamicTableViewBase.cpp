@@ -22,6 +22,18 @@ namespace ListConstants
 {
 	static const float OvershootMax = 150.0f;
 	static const float OvershootBounceRate = 250.0f;
+
+	/** Estimated item lengths never go below this, so that a degenerate estimate cannot make us measure the whole list at once */
+	static const float MinEstimatedItemLength = 1.0f;
+
+	/** How far beyond each end of the visible area, in view lengths, items get measured when using estimated lengths */
+	static const double EstimatedItemMeasureMargin = 1.0;
+
+	/** Number of items measured in one go by background measurement between two checks of the time budget */
+	static const int32 BackgroundMeasureBatchSize = 8;
+
+	/** Number of batches background measurement spends in the scroll direction for every batch in the other direction */
+	static const int32 BackgroundMeasureScrollDirectionBias = 3;
 }
 
 //
@@ -277,18 +289,29 @@ void SDynamicTableViewBase::Tick( const FGeometry& AllottedGeometry, const doubl
 
 		bool bPanelGeometryChanged = PanelGeometryLastTick.GetLocalSize() != PanelGeometry.GetLocalSize();
 		
-		if (bTotalItemLengthNeedRefresh || bPanelGeometryChanged)
+		if ( bItemsNeedRefresh || bPanelGeometryChanged)
 		{
-			ComputeTotalItemsLength(AllottedGeometry.GetAccumulatedLayoutTransform().GetScale());
+			const float LayoutScaleMultiplier = AllottedGeometry.GetAccumulatedLayoutTransform().GetScale();
+			const FTableViewDimensions PanelDimensions(Orientation, PanelGeometry.GetLocalSize());
 
-			bTotalItemLengthNeedRefresh = false;
-		}
+			// A view left at the end of the list stays there as items are appended, unless it is being scrolled back from it
+			const bool bStickingToEnd = bStickToEnd && bWasAtEndOfList && DesiredScrollOffset >= CurrentScrollOffset;
+
+			// Lengths changing before the item at the top of the view must not move what is on screen
+			CaptureScrollAnchor();
+			UpdateItemLengths(LayoutScaleMultiplier, PanelDimensions.LineAxis);
+			ApplyScrollAnchor();
+
+			if (bStickingToEnd)
+			{
+				CurrentScrollOffset = DesiredScrollOffset = FMath::Max(GetTotalItemsLength() - PanelDimensions.ScrollAxis, 0.0);
+			}
+
+			// Following the anchor is not a scroll, only what happens from here on tells the scroll direction
+			const double PreviousScrollOffset = CurrentScrollOffset;
 
-		if ( bItemsNeedRefresh || bPanelGeometryChanged)
-		{
 			PanelGeometryLastTick = PanelGeometry;
 			
-			const int32 NumItemsPerLine = GetNumItemsPerLine();
 			const EScrollIntoViewResult ScrollIntoViewResult = ScrollIntoView(PanelGeometry);
 
 			double TargetScrollOffset = GetTargetScrollOffset();
@@ -306,76 +329,84 @@ void SDynamicTableViewBase::Tick( const FGeometry& AllottedGeometry, const doubl
 				CurrentScrollOffset = TargetScrollOffset;
 			}
 
-			const FReGenerateResults ReGenerateResults = ReGenerateItems( PanelGeometry );
-			LastGenerateResults = ReGenerateResults;
-			
-			const int32 NumItemsBeingObserved = GetNumItemsBeingObserved();
-			const int32 NumItemLines = NumItemsBeingObserved / NumItemsPerLine;
-
-			const bool bEnoughRoomForAllItems = AllottedGeometry.GetLocalSize().Y >= ReGenerateResults.LengthOfGeneratedItems;
-			
-			const double InitialDesiredOffset = DesiredScrollOffset;
-			// const bool bEnoughRoomForAllItems = ReGenerateResults.ExactNumLinesOnScreen >= NumItemLines;
-			if (bEnoughRoomForAllItems)
-			{
-				// We can show all the items, so make sure there is no scrolling.
-				SetScrollOffset(0.0);
-				CurrentScrollOffset = TargetScrollOffset = DesiredScrollOffset;
-			}
-			else if (ReGenerateResults.bGeneratedPastLastItem)
+			if (CurrentScrollOffset != PreviousScrollOffset)
 			{
-				SetScrollOffset(FMath::Max(0.0, ReGenerateResults.NewScrollOffset));
-				CurrentScrollOffset = TargetScrollOffset = DesiredScrollOffset;
+				bLastScrolledBackward = CurrentScrollOffset < PreviousScrollOffset;
 			}
-			
-			ItemsPanel->SetFirstLineScrollOffset(GetFirstLineScrollOffset());
 
-			if (AllowOverscroll == EAllowOverscroll::Yes)
+			// Measuring items above the visible area shifts the scroll offset to keep the content still, the target has to follow
+			const double ScrollOffsetBeforeMeasuring = CurrentScrollOffset;
+			CaptureScrollAnchor();
+			MeasureItemsNearView(PanelDimensions.ScrollAxis, LayoutScaleMultiplier);
+			const bool bMoreItemsToMeasure = MeasureItemsInBackground(PanelDimensions.ScrollAxis, LayoutScaleMultiplier);
+			ApplyScrollAnchor();
+			TargetScrollOffset += CurrentScrollOffset - ScrollOffsetBeforeMeasuring;
+
+			// The rows just appended may have been measured longer than estimated, the end moved
+			if (bStickingToEnd && ScrollIntoViewResult == EScrollIntoViewResult::Failure)
 			{
-				const float OverscrollAmount = Overscroll.GetOverscroll(GetTickSpaceGeometry());
-				ItemsPanel->SetOverscrollAmount( OverscrollAmount );
+				CurrentScrollOffset = DesiredScrollOffset = TargetScrollOffset = FMath::Max(GetTotalItemsLength() - PanelDimensions.ScrollAxis, 0.0);
 			}
 
-			UpdateSelectionSet();
-
 			const double TotalItemsLength = GetTotalItemsLength();
-			
-			// Update scrollbar
-			if (NumItemsBeingObserved > 0)
+			const double ViewLength = PanelDimensions.ScrollAxis;
+
+			// When the scroll offset moved without any item entering or leaving the visible area, the widgets generated last time are still the right ones
+			// and only need to be moved. This keeps smooth and inertial scrolling from regenerating every row on every frame.
+			const bool bOnlyScrolled = !bItemsNeedRegeneration
+				&& !bPanelGeometryChanged
+				&& ScrollIntoViewResult == EScrollIntoViewResult::Failure
+				&& CurrentScrollOffset >= 0.
+				&& CurrentScrollOffset + ViewLength <= TotalItemsLength
+				&& LastGeneratedItemRange.FirstIndex != INDEX_NONE
+				&& GetVisibleItemRange(ViewLength) == LastGeneratedItemRange;
+
+			bool bItemsPanelChanged = false;
+			if (!bOnlyScrolled)
 			{
-				if (ReGenerateResults.ExactNumLinesOnScreen < 1.0f)
+				// The items panel keeps the rows still in view, only those that entered or left it are added or removed
+				WidgetsToDisplay.Reset();
+				WidgetLengthsToDisplay.Reset();
+				const FReGenerateResults ReGenerateResults = ReGenerateItems( PanelGeometry );
+				bItemsPanelChanged = ItemsPanel->SetItems(WidgetsToDisplay, WidgetLengthsToDisplay);
+				LastGenerateResults = ReGenerateResults;
+				bItemsNeedRegeneration = false;
+
+				const bool bEnoughRoomForAllItems = ViewLength >= TotalItemsLength;
+				
+				// const bool bEnoughRoomForAllItems = ReGenerateResults.ExactNumLinesOnScreen >= NumItemLines;
+				if (bEnoughRoomForAllItems)
 				{
-					// We are be observing a single row which is larger than the available visible area, so we should calculate thumb size based on that
-					const double VisibleSizeFraction = AllottedGeometry.GetLocalSize().Y / ReGenerateResults.LengthOfGeneratedItems;
-					const double ThumbSizeFraction = FMath::Min(VisibleSizeFraction, 1.0);
-					const double OffsetFraction = CurrentScrollOffset / TotalItemsLength;
-					// const double OffsetFraction = CurrentScrollOffset / NumItemsBeingObserved;
-					ScrollBar->SetState( OffsetFraction, ThumbSizeFraction );
+					// We can show all the items, so make sure there is no scrolling.
+					SetScrollOffset(0.0);
+					CurrentScrollOffset = TargetScrollOffset = DesiredScrollOffset;
 				}
-				else
+				else if (ReGenerateResults.bGeneratedPastLastItem)
 				{
-					// The thumb size is whatever fraction of the items we are currently seeing (including partially seen items).
-					// e.g. if we are seeing 0.5 of the first generated widget and 0.75 of the last widget, that's 1.25 widgets.
-					const double ThumbSizeFraction = AllottedGeometry.GetLocalSize().Y / TotalItemsLength;
-					auto T = (TotalItemsLength - AllottedGeometry.GetLocalSize().Y);
-					const double OffsetFraction = CurrentScrollOffset / TotalItemsLength;
-					// const double OffsetFraction = CurrentScrollOffset / NumItemsBeingObserved;
-					ScrollBar->SetState( OffsetFraction, ThumbSizeFraction );
+					SetScrollOffset(FMath::Max(0.0, ReGenerateResults.NewScrollOffset));
+					CurrentScrollOffset = TargetScrollOffset = DesiredScrollOffset;
 				}
+
+				// Rows backfilled at the end of the list are not the ones a scroll would keep, so the next refresh regenerates
+				LastGeneratedItemRange = (bEnoughRoomForAllItems || ReGenerateResults.bGeneratedPastLastItem) ? FVisibleItemRange() : GetVisibleItemRange(ViewLength);
+
+				UpdateSelectionSet();
 			}
-			else
+			
+			ItemsPanel->SetFirstLineScrollOffset(GetFirstLineScrollOffset());
+
+			if (AllowOverscroll == EAllowOverscroll::Yes)
 			{
-				const double ThumbSizeFraction = 1;
-				const double OffsetFraction = 0;
-				ScrollBar->SetState( OffsetFraction, ThumbSizeFraction );
+				const float OverscrollAmount = Overscroll.GetOverscroll(GetTickSpaceGeometry());
+				ItemsPanel->SetOverscrollAmount( OverscrollAmount );
 			}
 
-			bWasAtEndOfList = (ScrollBar->DistanceFromBottom() < SMALL_NUMBER);
+			UpdateScrollBar(ViewLength);
 
 			bItemsNeedRefresh = false;
 			ItemsPanel->SetRefreshPending(false);
 
-			Invalidate(EInvalidateWidget::ChildOrder);
+			Invalidate(bItemsPanelChanged ? EInvalidateWidget::ChildOrder : EInvalidateWidget::Layout);
 			
 			if (ScrollIntoViewResult == EScrollIntoViewResult::Success)
 			{
@@ -393,18 +424,357 @@ void SDynamicTableViewBase::Tick( const FGeometry& AllottedGeometry, const doubl
 			{
 				NotifyFinishedScrolling();
 			}
+
+			if (bMoreItemsToMeasure)
+			{
+				// Background measurement resumes next frame
+				RequestLayoutRefresh();
+			}
 		}
 	}
 }
 
 
-void SDynamicTableViewBase::ScrollBar_OnUserScrolled( float InScrollOffsetFraction )
+SDynamicTableViewBase::FVisibleItemRange SDynamicTableViewBase::GetVisibleItemRange(double ViewLength) const
+{
+	FVisibleItemRange VisibleItems;
+	VisibleItems.NumItems = GetNumItemsBeingObserved();
+
+	const int32 NumItemLengths = CachedItemLengths.Num();
+	if (NumItemLengths > 0)
+	{
+		VisibleItems.FirstIndex = FMath::Clamp(CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset), 0, NumItemLengths - 1);
+		VisibleItems.LastIndex = FMath::Clamp(CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset + ViewLength), VisibleItems.FirstIndex, NumItemLengths - 1);
+		VisibleItems.Length = CachedItemLengths.GetOffsetOf(VisibleItems.LastIndex + 1) - CachedItemLengths.GetOffsetOf(VisibleItems.FirstIndex);
+	}
+
+	return VisibleItems;
+}
+
+void SDynamicTableViewBase::CaptureScrollAnchor()
+{
+	ScrollAnchorIndex = CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset);
+	ScrollAnchorItemOffset = ScrollAnchorIndex != INDEX_NONE ? CachedItemLengths.GetOffsetOf(ScrollAnchorIndex) : 0.;
+}
+
+void SDynamicTableViewBase::ApplyScrollAnchor()
+{
+	if (CachedItemLengths.IsValidIndex(ScrollAnchorIndex))
+	{
+		const double AnchorDelta = CachedItemLengths.GetOffsetOf(ScrollAnchorIndex) - ScrollAnchorItemOffset;
+		if (AnchorDelta != 0.)
+		{
+			CurrentScrollOffset += AnchorDelta;
+			DesiredScrollOffset += AnchorDelta;
+		}
+	}
+	ScrollAnchorIndex = INDEX_NONE;
+}
+
+void SDynamicTableViewBase::UpdateScrollBar(double ViewLength)
+{
+	const double TotalItemsLength = GetTotalItemsLength();
+	if (GetNumItemsBeingObserved() > 0 && TotalItemsLength > 0.)
+	{
+		// Offsets are in Slate units, so the thumb is simply the visible length as a fraction of the total items length,
+		// which also covers a single row larger than the available visible area.
+		const double ThumbSizeFraction = FMath::Min(ViewLength / TotalItemsLength, 1.0);
+		const double OffsetFraction = CurrentScrollOffset / TotalItemsLength;
+		ScrollBar->SetState( OffsetFraction, ThumbSizeFraction );
+	}
+	else
+	{
+		const double ThumbSizeFraction = 1;
+		const double OffsetFraction = 0;
+		ScrollBar->SetState( OffsetFraction, ThumbSizeFraction );
+	}
+
+	bWasAtEndOfList = (ScrollBar->DistanceFromBottom() < SMALL_NUMBER);
+}
+
+void SDynamicTableViewBase::UpdateItemLengths(float LayoutScaleMultiplier, float LineAxisLength)
 {
-	const float ContentSize = GetTotalItemsLength();
-	const float ScrollPanelSize = GetCachedGeometry().GetLocalSize().Y;
+	const int32 NumItems = GetNumItemsBeingObserved();
 
-	//// Clamp to max scroll offset
-	const float ClampedScrollOffset = FMath::Min(InScrollOffsetFraction * ContentSize, ContentSize - ScrollPanelSize);
+	// Lengths only depend on the layout scale and the line axis size, so resizing along the scroll axis keeps them.
+	// Items removed without a refresh request leave us unable to tell which lengths are stale, so measure everything again.
+	if (bTotalItemLengthNeedRefresh
+		|| LayoutScaleMultiplier != MeasuredLayoutScaleMultiplier
+		|| LineAxisLength != MeasuredLineAxisLength
+		|| NumItems < CachedItemLengths.Num())
+	{
+		MeasuredLayoutScaleMultiplier = LayoutScaleMultiplier;
+		MeasuredLineAxisLength = LineAxisLength;
+
+		if (ShouldEstimateItemLengths())
+		{
+			ResetItemLengths(NumItems);
+
+			// Without anything to base the running average on, measure the first item so the estimates are in the right ballpark
+			if (EstimatedItemLength <= 0.f && PreviousItemLengthAverage <= 0.f && NumItems > 0)
+			{
+				ComputeItemLengthRange(0, 1, LayoutScaleMultiplier);
+			}
+			AddEstimatedItemLengths(NumItems - CachedItemLengths.Num(), LayoutScaleMultiplier);
+		}
+		else
+		{
+			ComputeTotalItemsLength(LayoutScaleMultiplier);
+		}
+
+		// Whatever background measurement was doing was for the previous items, start over from the view
+		NextItemToMeasureForward = 0;
+		NextItemToMeasureBackward = INDEX_NONE;
+
+		bTotalItemLengthNeedRefresh = false;
+		DirtyItemLengthRanges.Reset();
+		return;
+	}
+
+	// Items appended to the source since the last measurement
+	if (NumItems > CachedItemLengths.Num())
+	{
+		if (ShouldEstimateItemLengths())
+		{
+			AddEstimatedItemLengths(NumItems - CachedItemLengths.Num(), LayoutScaleMultiplier);
+		}
+		else
+		{
+			DirtyItemLengthRanges.Add(FInt32Interval(CachedItemLengths.Num(), NumItems - 1));
+		}
+	}
+
+	if (ShouldEstimateItemLengths())
+	{
+		// Stale items keep their last length as an estimate until they approach the visible area again
+		for (const FInt32Interval& DirtyRange : DirtyItemLengthRanges)
+		{
+			for (int32 ItemIndex = FMath::Max(DirtyRange.Min, 0); ItemIndex <= FMath::Min(DirtyRange.Max, MeasuredItemLengths.Num() - 1); ++ItemIndex)
+			{
+				if (MeasuredItemLengths[ItemIndex])
+				{
+					// The stale length leaves the average, measuring the item again puts its new length in
+					MeasuredItemLengths[ItemIndex] = false;
+					--NumMeasuredItems;
+					MeasuredItemLengthSum -= CachedItemLengths.GetLength(ItemIndex);
+				}
+			}
+		}
+		DirtyItemLengthRanges.Reset();
+		return;
+	}
+
+	// New lengths have to be appended in order
+	DirtyItemLengthRanges.Sort([](const FInt32Interval& A, const FInt32Interval& B) { return A.Min < B.Min; });
+
+	for (const FInt32Interval& DirtyRange : DirtyItemLengthRanges)
+	{
+		const int32 StartIndex = FMath::Max(DirtyRange.Min, 0);
+		const int32 EndIndex = FMath::Min(DirtyRange.Max, NumItems - 1);
+		if (StartIndex <= EndIndex && StartIndex <= CachedItemLengths.Num())
+		{
+			ComputeItemLengthRange(StartIndex, EndIndex - StartIndex + 1, LayoutScaleMultiplier);
+		}
+	}
+	DirtyItemLengthRanges.Reset();
+}
+
+void SDynamicTableViewBase::AddEstimatedItemLengths(int32 NumItems, float LayoutScaleMultiplier)
+{
+	const float ItemLengthEstimate = GetEstimatedItemLength();
+	for (int32 Count = 0; Count < NumItems; ++Count)
+	{
+		const TOptional<float> KnownLength = FindCachedItemLength(CachedItemLengths.Num(), LayoutScaleMultiplier);
+		CachedItemLengths.Add(KnownLength.Get(ItemLengthEstimate));
+		MeasuredItemLengths.Add(KnownLength.IsSet());
+		NumMeasuredItems += KnownLength.IsSet() ? 1 : 0;
+		MeasuredItemLengthSum += KnownLength.Get(0.f);
+	}
+}
+
+void SDynamicTableViewBase::MeasureItemsNearView(double ViewLength, float LayoutScaleMultiplier)
+{
+	if (!ShouldEstimateItemLengths() || CachedItemLengths.Num() == 0)
+	{
+		return;
+	}
+
+	const double Margin = ViewLength * ListConstants::EstimatedItemMeasureMargin;
+	const int32 NumItems = CachedItemLengths.Num();
+
+	// The window end is re-evaluated as we go: real lengths replacing estimates move both the items and (above the view) the scroll offset
+	int32 ItemIndex = CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset - Margin);
+	while (ItemIndex < NumItems && CachedItemLengths.GetOffsetOf(ItemIndex) < CurrentScrollOffset + ViewLength + Margin)
+	{
+		if (MeasuredItemLengths[ItemIndex])
+		{
+			++ItemIndex;
+			continue;
+		}
+
+		// Measure the whole run of estimated items that is expected to fall within the window in one go
+		const double WindowEnd = CurrentScrollOffset + ViewLength + Margin;
+		int32 RunEndIndex = ItemIndex + 1;
+		while (RunEndIndex < NumItems && !MeasuredItemLengths[RunEndIndex] && CachedItemLengths.GetOffsetOf(RunEndIndex) < WindowEnd)
+		{
+			++RunEndIndex;
+		}
+
+		ComputeItemLengthRange(ItemIndex, RunEndIndex - ItemIndex, LayoutScaleMultiplier);
+
+		if (!MeasuredItemLengths[ItemIndex])
+		{
+			// Nothing could be measured, don't spin on it
+			break;
+		}
+		ItemIndex = RunEndIndex;
+	}
+}
+
+void SDynamicTableViewBase::MeasureItemsAround(int32 ItemIndex, double ViewLength)
+{
+	if (!ShouldEstimateItemLengths() || !CachedItemLengths.IsValidIndex(ItemIndex))
+	{
+		return;
+	}
+
+	CaptureScrollAnchor();
+	MeasureEstimatedItems(ItemIndex, ItemIndex);
+
+	// Real lengths shorter than their estimate bring more items within a view length, so go on until the window stops growing
+	bool bMeasuredItems = true;
+	while (bMeasuredItems)
+	{
+		const int32 FirstIndex = CachedItemLengths.FindIndexAtOffset(CachedItemLengths.GetOffsetOf(ItemIndex) - ViewLength);
+		bMeasuredItems = MeasureEstimatedItems(FirstIndex, ItemIndex - 1);
+	}
+
+	bMeasuredItems = true;
+	while (bMeasuredItems)
+	{
+		const int32 LastIndex = CachedItemLengths.FindIndexAtOffset(CachedItemLengths.GetOffsetOf(ItemIndex + 1) + ViewLength);
+		bMeasuredItems = MeasureEstimatedItems(ItemIndex + 1, LastIndex);
+	}
+	ApplyScrollAnchor();
+}
+
+bool SDynamicTableViewBase::MeasureEstimatedItems(int32 FirstIndex, int32 LastIndex)
+{
+	bool bMeasuredItems = false;
+	int32 ItemIndex = FMath::Max(FirstIndex, 0);
+	LastIndex = FMath::Min(LastIndex, CachedItemLengths.Num() - 1);
+	while (ItemIndex <= LastIndex)
+	{
+		if (MeasuredItemLengths[ItemIndex])
+		{
+			++ItemIndex;
+			continue;
+		}
+
+		int32 RunEndIndex = ItemIndex + 1;
+		while (RunEndIndex <= LastIndex && !MeasuredItemLengths[RunEndIndex])
+		{
+			++RunEndIndex;
+		}
+
+		ComputeItemLengthRange(ItemIndex, RunEndIndex - ItemIndex, MeasuredLayoutScaleMultiplier);
+
+		if (!MeasuredItemLengths[ItemIndex])
+		{
+			// Nothing could be measured, don't spin on it
+			break;
+		}
+		bMeasuredItems = true;
+		ItemIndex = RunEndIndex;
+	}
+	return bMeasuredItems;
+}
+
+bool SDynamicTableViewBase::MeasureItemsInBackground(double ViewLength, float LayoutScaleMultiplier)
+{
+	const int32 NumItems = CachedItemLengths.Num();
+	if (ItemMeasurementBudgetMs <= 0.f || !ShouldEstimateItemLengths() || NumMeasuredItems >= NumItems)
+	{
+		return false;
+	}
+
+	const int32 FirstVisibleIndex = CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset);
+	const int32 LastVisibleIndex = CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset + ViewLength);
+	const bool bExhausted = NextItemToMeasureForward >= NumItems && NextItemToMeasureBackward < 0;
+
+	// Everything between the two cursors is measured. Start over from the view when it left that area,
+	// or when both ends were reached but items were invalidated behind the cursors.
+	if (bExhausted || FirstVisibleIndex <= NextItemToMeasureBackward || LastVisibleIndex >= NextItemToMeasureForward)
+	{
+		NextItemToMeasureBackward = FirstVisibleIndex - 1;
+		NextItemToMeasureForward = FirstVisibleIndex;
+	}
+
+	const int32 NumMeasuredItemsBefore = NumMeasuredItems;
+	const double EndTime = FPlatformTime::Seconds() + ItemMeasurementBudgetMs / 1000.0;
+	int32 BatchCount = 0;
+
+	do
+	{
+		const bool bCanMeasureForward = NextItemToMeasureForward < NumItems;
+		const bool bCanMeasureBackward = NextItemToMeasureBackward >= 0;
+		if (!bCanMeasureForward && !bCanMeasureBackward)
+		{
+			break;
+		}
+
+		// Every few batches in the scroll direction, do one in the other direction
+		const bool bFavourScrollDirection = (BatchCount++ % (ListConstants::BackgroundMeasureScrollDirectionBias + 1)) != ListConstants::BackgroundMeasureScrollDirectionBias;
+		const bool bPreferForward = bFavourScrollDirection != bLastScrolledBackward;
+		if ((bPreferForward && bCanMeasureForward) || !bCanMeasureBackward)
+		{
+			while (NextItemToMeasureForward < NumItems && MeasuredItemLengths[NextItemToMeasureForward])
+			{
+				++NextItemToMeasureForward;
+			}
+
+			int32 RunEndIndex = NextItemToMeasureForward;
+			while (RunEndIndex < NumItems && !MeasuredItemLengths[RunEndIndex] && RunEndIndex - NextItemToMeasureForward < ListConstants::BackgroundMeasureBatchSize)
+			{
+				++RunEndIndex;
+			}
+
+			if (RunEndIndex > NextItemToMeasureForward)
+			{
+				ComputeItemLengthRange(NextItemToMeasureForward, RunEndIndex - NextItemToMeasureForward, LayoutScaleMultiplier);
+			}
+			NextItemToMeasureForward = RunEndIndex;
+		}
+		else
+		{
+			while (NextItemToMeasureBackward >= 0 && MeasuredItemLengths[NextItemToMeasureBackward])
+			{
+				--NextItemToMeasureBackward;
+			}
+
+			int32 RunStartIndex = NextItemToMeasureBackward + 1;
+			while (RunStartIndex > 0 && !MeasuredItemLengths[RunStartIndex - 1] && NextItemToMeasureBackward - RunStartIndex + 1 < ListConstants::BackgroundMeasureBatchSize)
+			{
+				--RunStartIndex;
+			}
+
+			if (RunStartIndex <= NextItemToMeasureBackward)
+			{
+				ComputeItemLengthRange(RunStartIndex, NextItemToMeasureBackward - RunStartIndex + 1, LayoutScaleMultiplier);
+			}
+			NextItemToMeasureBackward = RunStartIndex - 1;
+		}
+	}
+	while (FPlatformTime::Seconds() < EndTime);
+
+	// Items that could not be measured must not keep us ticking forever
+	return NumMeasuredItems > NumMeasuredItemsBefore && NumMeasuredItems < NumItems;
+}
+
+void SDynamicTableViewBase::ScrollBar_OnUserScrolled( float InScrollOffsetFraction )
+{
+	// Clamp to max scroll offset
+	const double ClampedScrollOffset = FMath::Clamp(InScrollOffsetFraction * GetTotalItemsLength(), 0.0, GetMaxScrollOffset());
 
 	ScrollTo(ClampedScrollOffset);
 }
@@ -510,7 +880,7 @@ FReply SDynamicTableViewBase::OnMouseMove( const FGeometry& MyGeometry, const FP
 		FTableViewDimensions CursorDeltaDimensions(Orientation, MouseEvent.GetCursorDelta());
 		CursorDeltaDimensions.LineAxis = 0.f;
 		
-		const float ScrollByAmount = CursorDeltaDimensions.ScrollAxis / MyGeometry.Scale;
+		const double ScrollByAmount = CursorDeltaDimensions.ScrollAxis / MyGeometry.Scale;
 
 		// If scrolling with the right mouse button, we need to remember how much we scrolled.
 		// If we did not scroll at all, we will bring up the context menu when the mouse is released.
@@ -529,7 +899,7 @@ FReply SDynamicTableViewBase::OnMouseMove( const FGeometry& MyGeometry, const FP
 
 			TickScrollDelta -= ScrollByAmount;
 
-			const float AmountScrolled = this->ScrollBy( MyGeometry, -ScrollByAmount, AllowOverscroll );
+			const double AmountScrolled = this->ScrollBy( MyGeometry, -ScrollByAmount, AllowOverscroll );
 
 			FReply Reply = FReply::Handled();
 
@@ -593,13 +963,14 @@ FReply SDynamicTableViewBase::OnMouseWheel( const FGeometry& MyGeometry, const F
 		// Make sure scroll velocity is cleared so it doesn't fight with the mouse wheel input
 		this->InertialScrollManager.ClearScrollVelocity();
 
-		float AmountScrolledInItems = 0.f;
-		if (FixedLineScrollOffset.IsSet()) // TODO Remove??
+		double AmountScrolledInItems = 0.0;
+		if (FixedLineScrollOffset.IsSet() && CachedItemLengths.Num() > 0)
 		{
 			// When we need to maintain a fixed offset, we scroll by items. This prevents the list not moving or jumping unexpectedly far on an individual scroll wheel motion.
-			const double AdditionalOffset = (MouseEvent.GetWheelDelta() >= 0.f ? -1.f : 1.f) * GetGlobalScrollAmount() * WheelScrollMultiplier;
-			const double NewScrollOffset = FMath::Max(0., DesiredScrollOffset + AdditionalOffset);
-			AmountScrolledInItems = this->ScrollTo(NewScrollOffset);
+			const int32 NumItemsToScroll = FMath::Max(1, FMath::RoundToInt(WheelScrollMultiplier));
+			const int32 CurrentItemIndex = CachedItemLengths.FindIndexAtOffset(DesiredScrollOffset);
+			const int32 NewItemIndex = FMath::Clamp(CurrentItemIndex + (MouseEvent.GetWheelDelta() >= 0.f ? -NumItemsToScroll : NumItemsToScroll), 0, CachedItemLengths.Num() - 1);
+			AmountScrolledInItems = this->ScrollTo(FMath::Min(CachedItemLengths.GetOffsetOf(NewItemIndex), GetMaxScrollOffset()));
 		}
 		else
 		{
@@ -655,7 +1026,7 @@ FReply SDynamicTableViewBase::OnTouchMoved( const FGeometry& MyGeometry, const F
 		FTableViewDimensions CursorDeltaDimensions(Orientation, InTouchEvent.GetCursorDelta());
 		CursorDeltaDimensions.LineAxis = 0.f;
 
-		const float ScrollByAmount = CursorDeltaDimensions.ScrollAxis / MyGeometry.Scale;
+		const double ScrollByAmount = CursorDeltaDimensions.ScrollAxis / MyGeometry.Scale;
 
 		AmountScrolledWhileRightMouseDown += FMath::Abs( ScrollByAmount );
 		
@@ -670,7 +1041,7 @@ FReply SDynamicTableViewBase::OnTouchMoved( const FGeometry& MyGeometry, const F
 				RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SDynamicTableViewBase::UpdateInertialScroll));
 			}
 
-			const float AmountScrolled = this->ScrollBy( MyGeometry, -ScrollByAmount, AllowOverscroll );
+			const double AmountScrolled = this->ScrollBy( MyGeometry, -ScrollByAmount, AllowOverscroll );
 			if (AmountScrolled != 0)
 			{
 				ScrollBar->BeginScrolling();
@@ -735,10 +1106,441 @@ bool SDynamicTableViewBase::IsUserScrolling() const
 void SDynamicTableViewBase::RequestListRefresh()
 {
 	bTotalItemLengthNeedRefresh = true;
+	bItemsNeedRegeneration = true;
 
 	RequestLayoutRefresh();
 }
 
+void SDynamicTableViewBase::InvalidateItemLengthRange(int32 StartIndex, int32 NumItems)
+{
+	if (NumItems > 0)
+	{
+		DirtyItemLengthRanges.Add(FInt32Interval(StartIndex, StartIndex + NumItems - 1));
+		DiscardCachedItemLengths(StartIndex, NumItems);
+
+		// Items out of view changing length only move the scroll anchor, the rows on screen can stay
+		const bool bOverlapsGeneratedItems = LastGeneratedItemRange.FirstIndex == INDEX_NONE
+			|| (StartIndex <= LastGeneratedItemRange.LastIndex && StartIndex + NumItems - 1 >= LastGeneratedItemRange.FirstIndex);
+		if (bOverlapsGeneratedItems)
+		{
+			bItemsNeedRegeneration = true;
+		}
+
+		RequestLayoutRefresh();
+	}
+}
+
+void SDynamicTableViewBase::ForgetItemLengths(int32 StartIndex, int32 NumItems)
+{
+	if (NumItems > 0)
+	{
+		DiscardCachedItemLengths(StartIndex, NumItems);
+	}
+}
+
+void SDynamicTableViewBase::NotifyItemsInserted(int32 Index, int32 NumItems)
+{
+	if (NumItems <= 0)
+	{
+		return;
+	}
+
+	// With a full measurement pending there are no lengths to patch
+	if (!bTotalItemLengthNeedRefresh)
+	{
+		if (Index < 0 || Index > CachedItemLengths.Num() || CachedItemLengths.Num() + NumItems > GetNumItemsBeingObserved())
+		{
+			// The items source does not match the lengths we hold, so we cannot tell which items are new
+			RequestListRefresh();
+			return;
+		}
+
+		// Items whose length is already known need no measuring, the others start from an estimate
+		const float ItemLengthEstimate = GetEstimatedItemLength();
+		TArray<float> InsertedLengths;
+		InsertedLengths.Reserve(NumItems);
+		TBitArray<> InsertedLengthsMeasured;
+		bool bAllLengthsKnown = true;
+		for (int32 ItemIndex = Index; ItemIndex < Index + NumItems; ++ItemIndex)
+		{
+			const TOptional<float> KnownLength = FindCachedItemLength(ItemIndex, MeasuredLayoutScaleMultiplier);
+			InsertedLengths.Add(KnownLength.Get(ItemLengthEstimate));
+			InsertedLengthsMeasured.Add(KnownLength.IsSet());
+			bAllLengthsKnown &= KnownLength.IsSet();
+		}
+		InsertItemLengths(Index, InsertedLengths, InsertedLengthsMeasured);
+
+		// Estimated lengths get measured as they approach the visible area, otherwise they are measured on next tick
+		if (!bAllLengthsKnown && !ShouldEstimateItemLengths())
+		{
+			DirtyItemLengthRanges.Add(FInt32Interval(Index, Index + NumItems - 1));
+		}
+	}
+
+	bItemsNeedRegeneration = true;
+	RequestLayoutRefresh();
+}
+
+void SDynamicTableViewBase::NotifyItemsRemoved(int32 Index, int32 NumItems)
+{
+	if (NumItems <= 0)
+	{
+		return;
+	}
+
+	if (!bTotalItemLengthNeedRefresh)
+	{
+		if (Index < 0 || Index + NumItems > CachedItemLengths.Num() || CachedItemLengths.Num() - NumItems > GetNumItemsBeingObserved())
+		{
+			RequestListRefresh();
+			return;
+		}
+
+		RemoveItemLengths(Index, NumItems);
+	}
+
+	bItemsNeedRegeneration = true;
+	RequestLayoutRefresh();
+}
+
+void SDynamicTableViewBase::NotifyItemsMoved(int32 FromIndex, int32 NumItems, int32 ToIndex)
+{
+	if (NumItems <= 0 || FromIndex == ToIndex)
+	{
+		return;
+	}
+
+	if (!bTotalItemLengthNeedRefresh)
+	{
+		if (FromIndex < 0 || ToIndex < 0 || FMath::Max(FromIndex, ToIndex) + NumItems > CachedItemLengths.Num())
+		{
+			RequestListRefresh();
+			return;
+		}
+
+		TArray<float> MovedLengths;
+		MovedLengths.Reserve(NumItems);
+		TBitArray<> MovedLengthsMeasured;
+		for (int32 ItemIndex = FromIndex; ItemIndex < FromIndex + NumItems; ++ItemIndex)
+		{
+			MovedLengths.Add(CachedItemLengths.GetLength(ItemIndex));
+			MovedLengthsMeasured.Add(MeasuredItemLengths[ItemIndex]);
+		}
+
+		// Stale lengths among the moved items stay stale at their new place
+		const bool bMovedItemsDirty = DirtyItemLengthRanges.ContainsByPredicate([FromIndex, NumItems](const FInt32Interval& DirtyRange)
+		{
+			return DirtyRange.Min < FromIndex + NumItems && DirtyRange.Max >= FromIndex;
+		});
+
+		RemoveItemLengths(FromIndex, NumItems);
+		InsertItemLengths(ToIndex, MovedLengths, MovedLengthsMeasured);
+
+		if (bMovedItemsDirty)
+		{
+			DirtyItemLengthRanges.Add(FInt32Interval(ToIndex, ToIndex + NumItems - 1));
+		}
+	}
+
+	bItemsNeedRegeneration = true;
+	RequestLayoutRefresh();
+}
+
+void SDynamicTableViewBase::NotifyItemsReplaced(int32 Index, int32 NumItems)
+{
+	if (NumItems > 0)
+	{
+		// Unlike InvalidateItemLengthRange, lengths remembered for the new items are still right
+		DirtyItemLengthRanges.Add(FInt32Interval(Index, Index + NumItems - 1));
+		bItemsNeedRegeneration = true;
+
+		RequestLayoutRefresh();
+	}
+}
+
+void SDynamicTableViewBase::NotifyItemsReordered(TArrayView<const int32> PreviousIndices)
+{
+	if (!bTotalItemLengthNeedRefresh)
+	{
+		if (PreviousIndices.Num() != GetNumItemsBeingObserved())
+		{
+			RequestListRefresh();
+			return;
+		}
+
+		const int32 NumPreviousItems = CachedItemLengths.Num();
+
+		// The item the view starts on, and how far into it
+		const int32 AnchorIndex = CachedItemLengths.FindIndexAtOffset(CurrentScrollOffset);
+		const double AnchorOffset = AnchorIndex != INDEX_NONE ? CurrentScrollOffset - CachedItemLengths.GetOffsetOf(AnchorIndex) : 0.;
+		const double PendingScrollDelta = DesiredScrollOffset - CurrentScrollOffset;
+
+		TBitArray<> PreviousItemsDirty(false, NumPreviousItems);
+		for (const FInt32Interval& DirtyRange : DirtyItemLengthRanges)
+		{
+			for (int32 ItemIndex = FMath::Max(DirtyRange.Min, 0); ItemIndex <= FMath::Min(DirtyRange.Max, NumPreviousItems - 1); ++ItemIndex)
+			{
+				PreviousItemsDirty[ItemIndex] = true;
+			}
+		}
+
+		const float ItemLengthEstimate = GetEstimatedItemLength();
+		TArray<float> NewLengths;
+		NewLengths.Reserve(PreviousIndices.Num());
+		TBitArray<> NewMeasuredItemLengths;
+		TArray<FInt32Interval> NewDirtyItemLengthRanges;
+		int32 NewNumMeasuredItems = 0;
+		double NewMeasuredItemLengthSum = 0.;
+		int32 NewAnchorIndex = INDEX_NONE;
+
+		for (int32 ItemIndex = 0; ItemIndex < PreviousIndices.Num(); ++ItemIndex)
+		{
+			const int32 PreviousIndex = PreviousIndices[ItemIndex];
+			bool bMeasured = false;
+			bool bDirty = false;
+			if (PreviousIndex >= 0 && PreviousIndex < NumPreviousItems)
+			{
+				NewLengths.Add(CachedItemLengths.GetLength(PreviousIndex));
+				bMeasured = MeasuredItemLengths[PreviousIndex];
+				bDirty = PreviousItemsDirty[PreviousIndex];
+				NewAnchorIndex = PreviousIndex == AnchorIndex ? ItemIndex : NewAnchorIndex;
+			}
+			else
+			{
+				// New items are measured like inserted ones
+				const TOptional<float> KnownLength = FindCachedItemLength(ItemIndex, MeasuredLayoutScaleMultiplier);
+				NewLengths.Add(KnownLength.Get(ItemLengthEstimate));
+				bMeasured = KnownLength.IsSet();
+				bDirty = !KnownLength.IsSet() && !ShouldEstimateItemLengths();
+			}
+
+			NewMeasuredItemLengths.Add(bMeasured);
+			NewNumMeasuredItems += bMeasured ? 1 : 0;
+			NewMeasuredItemLengthSum += bMeasured ? NewLengths.Last() : 0.;
+
+			if (bDirty)
+			{
+				if (NewDirtyItemLengthRanges.Num() > 0 && NewDirtyItemLengthRanges.Last().Max == ItemIndex - 1)
+				{
+					NewDirtyItemLengthRanges.Last().Max = ItemIndex;
+				}
+				else
+				{
+					NewDirtyItemLengthRanges.Add(FInt32Interval(ItemIndex, ItemIndex));
+				}
+			}
+		}
+
+		CachedItemLengths.Reset(NewLengths.Num());
+		for (const float Length : NewLengths)
+		{
+			CachedItemLengths.Add(Length);
+		}
+		MeasuredItemLengths = MoveTemp(NewMeasuredItemLengths);
+		NumMeasuredItems = NewNumMeasuredItems;
+		MeasuredItemLengthSum = NewMeasuredItemLengthSum;
+		DirtyItemLengthRanges = MoveTemp(NewDirtyItemLengthRanges);
+
+		// Keep the content in view where it was, unless we were at the top where the new first items are revealed instead
+		if (CurrentScrollOffset > 0. && NewAnchorIndex != INDEX_NONE)
+		{
+			CurrentScrollOffset = CachedItemLengths.GetOffsetOf(NewAnchorIndex) + AnchorOffset;
+			DesiredScrollOffset = CurrentScrollOffset + PendingScrollDelta;
+		}
+
+		NextItemToMeasureForward = 0;
+		NextItemToMeasureBackward = INDEX_NONE;
+	}
+
+	bItemsNeedRegeneration = true;
+	RequestLayoutRefresh();
+}
+
+void SDynamicTableViewBase::InsertItemLengths(int32 Index, TArrayView<const float> InLengths, const TBitArray<>& InMeasured)
+{
+	const int32 NumItems = InLengths.Num();
+	const double InsertedOffset = CachedItemLengths.GetOffsetOf(Index);
+
+	CachedItemLengths.Insert(Index, InLengths);
+	MeasuredItemLengths.Insert(false, Index, NumItems);
+	for (int32 InsertedIndex = 0; InsertedIndex < NumItems; ++InsertedIndex)
+	{
+		if (InMeasured[InsertedIndex])
+		{
+			MeasuredItemLengths[Index + InsertedIndex] = true;
+			++NumMeasuredItems;
+			MeasuredItemLengthSum += InLengths[InsertedIndex];
+		}
+	}
+
+	// Items inserted above the visible area push the content in view down: follow it so it does not move.
+	// At the very top of the list, the new items are revealed instead.
+	if (CurrentScrollOffset > 0. && InsertedOffset <= CurrentScrollOffset)
+	{
+		const double InsertedLength = CachedItemLengths.GetOffsetOf(Index + NumItems) - InsertedOffset;
+		CurrentScrollOffset += InsertedLength;
+		DesiredScrollOffset += InsertedLength;
+	}
+
+	for (FInt32Interval& DirtyRange : DirtyItemLengthRanges)
+	{
+		DirtyRange.Min += DirtyRange.Min >= Index ? NumItems : 0;
+		DirtyRange.Max += DirtyRange.Max >= Index ? NumItems : 0;
+	}
+
+	// Background measurement starts over from the view
+	NextItemToMeasureForward = 0;
+	NextItemToMeasureBackward = INDEX_NONE;
+}
+
+void SDynamicTableViewBase::RemoveItemLengths(int32 Index, int32 NumItems)
+{
+	const double RemovedStartOffset = CachedItemLengths.GetOffsetOf(Index);
+	const double RemovedEndOffset = CachedItemLengths.GetOffsetOf(Index + NumItems);
+
+	for (int32 ItemIndex = Index; ItemIndex < Index + NumItems; ++ItemIndex)
+	{
+		if (MeasuredItemLengths[ItemIndex])
+		{
+			--NumMeasuredItems;
+			MeasuredItemLengthSum -= CachedItemLengths.GetLength(ItemIndex);
+		}
+	}
+	CachedItemLengths.RemoveAt(Index, NumItems);
+	MeasuredItemLengths.RemoveAt(Index, NumItems);
+
+	// Follow the content in view when items above it went away, or stop where the removed items were when the view started among them
+	const double ScrollOffsetDelta = CurrentScrollOffset >= RemovedEndOffset
+		? RemovedStartOffset - RemovedEndOffset
+		: FMath::Min(RemovedStartOffset - CurrentScrollOffset, 0.0);
+	CurrentScrollOffset += ScrollOffsetDelta;
+	DesiredScrollOffset = FMath::Max(DesiredScrollOffset + ScrollOffsetDelta, 0.0);
+
+	for (int32 RangeIndex = DirtyItemLengthRanges.Num() - 1; RangeIndex >= 0; --RangeIndex)
+	{
+		FInt32Interval& DirtyRange = DirtyItemLengthRanges[RangeIndex];
+		DirtyRange.Min = DirtyRange.Min >= Index + NumItems ? DirtyRange.Min - NumItems : FMath::Min(DirtyRange.Min, Index);
+		DirtyRange.Max = DirtyRange.Max >= Index + NumItems ? DirtyRange.Max - NumItems : FMath::Min(DirtyRange.Max, Index - 1);
+		if (DirtyRange.Min > DirtyRange.Max)
+		{
+			DirtyItemLengthRanges.RemoveAtSwap(RangeIndex);
+		}
+	}
+
+	NextItemToMeasureForward = 0;
+	NextItemToMeasureBackward = INDEX_NONE;
+}
+
+void SDynamicTableViewBase::SetUseEstimatedItemLengths(bool bInUseEstimatedItemLengths, float InEstimatedItemLength)
+{
+	if (bUseEstimatedItemLengths != bInUseEstimatedItemLengths || EstimatedItemLength != InEstimatedItemLength)
+	{
+		bUseEstimatedItemLengths = bInUseEstimatedItemLengths;
+		EstimatedItemLength = InEstimatedItemLength;
+
+		RequestListRefresh();
+	}
+}
+
+void SDynamicTableViewBase::SetItemMeasurementBudget(float InMillisecondsPerFrame)
+{
+	const float NewBudgetMs = FMath::Max(InMillisecondsPerFrame, 0.f);
+	if (ItemMeasurementBudgetMs != NewBudgetMs)
+	{
+		const bool bWasEstimatingItemLengths = ShouldEstimateItemLengths();
+		ItemMeasurementBudgetMs = NewBudgetMs;
+
+		if (ShouldEstimateItemLengths() != bWasEstimatingItemLengths)
+		{
+			RequestListRefresh();
+		}
+		else
+		{
+			RequestLayoutRefresh();
+		}
+	}
+}
+
+bool SDynamicTableViewBase::IsMeasuringItems() const
+{
+	return ItemMeasurementBudgetMs > 0.f && NumMeasuredItems < CachedItemLengths.Num();
+}
+
+float SDynamicTableViewBase::GetItemMeasurementProgress() const
+{
+	const int32 NumItems = CachedItemLengths.Num();
+	return NumItems > 0 ? (float)NumMeasuredItems / NumItems : 1.f;
+}
+
+bool SDynamicTableViewBase::ShouldEstimateItemLengths() const
+{
+	return bUseEstimatedItemLengths || ItemMeasurementBudgetMs > 0.f;
+}
+
+float SDynamicTableViewBase::GetEstimatedItemLength() const
+{
+	const float ItemLengthEstimate = EstimatedItemLength > 0.f
+		? EstimatedItemLength
+		: (NumMeasuredItems > 0 ? (float)(MeasuredItemLengthSum / NumMeasuredItems) : PreviousItemLengthAverage);
+
+	return FMath::Max(ItemLengthEstimate, ListConstants::MinEstimatedItemLength);
+}
+
+void SDynamicTableViewBase::ResetItemLengths(int32 NumItemsToReserve)
+{
+	if (bForgetItemLengthEstimate)
+	{
+		PreviousItemLengthAverage = 0.f;
+		bForgetItemLengthEstimate = false;
+	}
+	else if (NumMeasuredItems > 0)
+	{
+		PreviousItemLengthAverage = (float)(MeasuredItemLengthSum / NumMeasuredItems);
+	}
+
+	CachedItemLengths.Reset(NumItemsToReserve);
+	MeasuredItemLengths.Reset();
+	NumMeasuredItems = 0;
+	MeasuredItemLengthSum = 0.;
+}
+
+void SDynamicTableViewBase::ForgetItemLengthEstimate()
+{
+	bForgetItemLengthEstimate = true;
+}
+
+void SDynamicTableViewBase::SetMeasuredItemLength(int32 ItemIndex, float InLength)
+{
+	if (ItemIndex == CachedItemLengths.Num())
+	{
+		CachedItemLengths.Add(InLength);
+		MeasuredItemLengths.Add(true);
+		++NumMeasuredItems;
+		MeasuredItemLengthSum += InLength;
+		return;
+	}
+
+	if (!ensure(CachedItemLengths.IsValidIndex(ItemIndex)))
+	{
+		return;
+	}
+
+	// A measured item measured again replaces its length in the average rather than counting twice
+	if (MeasuredItemLengths[ItemIndex])
+	{
+		MeasuredItemLengthSum -= CachedItemLengths.GetLength(ItemIndex);
+	}
+	else
+	{
+		MeasuredItemLengths[ItemIndex] = true;
+		++NumMeasuredItems;
+	}
+	MeasuredItemLengthSum += InLength;
+
+	// Items above the view changing length move the scroll anchor, which the caller applies once it is done measuring
+	CachedItemLengths.SetLength(ItemIndex, InLength);
+}
+
 bool SDynamicTableViewBase::IsPendingRefresh() const
 {
 	return bItemsNeedRefresh || ItemsPanel->IsRefreshPending();
@@ -794,7 +1596,7 @@ SDynamicTableViewBase::SDynamicTableViewBase( ETableViewMode::Type InTableViewMo
 	: TableViewMode( InTableViewMode )
 	, bStartedTouchInteraction( false )
 	, AmountScrolledWhileRightMouseDown( 0 )
-	, TickScrollDelta( 0 )
+	, TickScrollDelta( 0. )
 	, LastGenerateResults( 0,0,0,false )
 	, bWasAtEndOfList(false)
 	, SelectionMode( ESelectionMode::Multi )
@@ -813,25 +1615,27 @@ SDynamicTableViewBase::SDynamicTableViewBase( ETableViewMode::Type InTableViewMo
 
 double SDynamicTableViewBase::GetTargetScrollOffset() const
 {
-	if (FixedLineScrollOffset.IsSet() && !IsRightClickScrolling() && InertialScrollManager.GetScrollVelocity() == 0.f)
+	if (FixedLineScrollOffset.IsSet() && !IsRightClickScrolling() && InertialScrollManager.GetScrollVelocity() == 0.f && CachedItemLengths.Num() > 0)
 	{
-		const int32 NumItemsPerLine = GetNumItemsPerLine();
-		const double DesiredLineOffset = FMath::FloorToDouble(DesiredScrollOffset / NumItemsPerLine) - FixedLineScrollOffset.GetValue();
-		
-		//return FMath::Max(0.0, FMath::CeilToDouble(DesiredScrollOffset) - AdditionalOffset);
-		return FMath::Max(0.0, DesiredLineOffset * NumItemsPerLine);
+		// Settle on the start of the item at the desired offset, pushed down by a fraction of the preceding item
+		const int32 FirstItemIndex = CachedItemLengths.FindIndexAtOffset(DesiredScrollOffset);
+		const double PrecedingItemLength = FirstItemIndex > 0 ? CachedItemLengths.GetLength(FirstItemIndex - 1) : 0.;
+		const double DesiredLineOffset = CachedItemLengths.GetOffsetOf(FirstItemIndex) - FixedLineScrollOffset.GetValue() * PrecedingItemLength;
+
+		return FMath::Max(0.0, DesiredLineOffset);
 	}
 	return DesiredScrollOffset;
 }
 
-float SDynamicTableViewBase::ScrollBy(const FGeometry& MyGeometry, float ScrollByAmount, EAllowOverscroll InAllowOverscroll)
+double SDynamicTableViewBase::ScrollBy(const FGeometry& MyGeometry, double ScrollByAmount, EAllowOverscroll InAllowOverscroll)
 {
-	const float ScrollMin = 0.0f;
-	const float ScrollMax = FMath::Max(GetTotalItemsLength() - MyGeometry.GetLocalSize().Y, 0.f);
+	const double ScrollMin = 0.0;
+	const double ScrollMax = GetMaxScrollOffset();
 
 	if (InAllowOverscroll == EAllowOverscroll::Yes && Overscroll.ShouldApplyOverscroll(FMath::IsNearlyZero(DesiredScrollOffset), FMath::IsNearlyEqual(DesiredScrollOffset, ScrollMax), ScrollByAmount))
 	{
-		const float ActuallyScrolledBy = Overscroll.ScrollBy(MyGeometry, ScrollByAmount);
+		// Overscroll only ever amounts to a few Slate units, single precision is plenty for it
+		const float ActuallyScrolledBy = Overscroll.ScrollBy(MyGeometry, (float)ScrollByAmount);
 		if (ActuallyScrolledBy != 0.0f)
 		{
 			this->RequestLayoutRefresh();
@@ -839,15 +1643,14 @@ float SDynamicTableViewBase::ScrollBy(const FGeometry& MyGeometry, float ScrollB
 		}
 	}
 
-	// const float AvgItemLength = GetTotalItemsLength() / GetNumItemsBeingObserved();
-	// const double ClampedScrollOffset = FMath::Clamp(DesiredScrollOffset + ScrollByAmount, ScrollMin - (AvgItemLength * 10.f), ScrollMax + (AvgItemLength * 10.f));
-	return ScrollTo(DesiredScrollOffset + ScrollByAmount);
+	const double ClampedScrollOffset = FMath::Clamp(DesiredScrollOffset + ScrollByAmount, ScrollMin, ScrollMax);
+	return ScrollTo(ClampedScrollOffset);
 }
 
-float SDynamicTableViewBase::ScrollTo( float InScrollOffset)
+double SDynamicTableViewBase::ScrollTo( double InScrollOffset)
 {
-	const float NewScrollOffset = FMath::Clamp( InScrollOffset, -10.0f, GetTotalItemsLength()+10.0f );
-	float AmountScrolled = FMath::Abs( DesiredScrollOffset - NewScrollOffset );
+	const double NewScrollOffset = FMath::Clamp( InScrollOffset, -10.0, GetTotalItemsLength()+10.0 );
+	double AmountScrolled = FMath::Abs( DesiredScrollOffset - NewScrollOffset );
 
 	if (bWasAtEndOfList && NewScrollOffset >= DesiredScrollOffset)
 	{
@@ -859,14 +1662,14 @@ float SDynamicTableViewBase::ScrollTo( float InScrollOffset)
 	return AmountScrolled;
 }
 
-float SDynamicTableViewBase::GetScrollOffset() const
+double SDynamicTableViewBase::GetScrollOffset() const
 {
 	return DesiredScrollOffset;
 }
 
-void SDynamicTableViewBase::SetScrollOffset( const float InScrollOffset )
+void SDynamicTableViewBase::SetScrollOffset( const double InScrollOffset )
 {
-	const float InValidatedOffset = FMath::Max(0.0f, InScrollOffset);
+	const double InValidatedOffset = FMath::Max(0.0, InScrollOffset);
 	if (DesiredScrollOffset != InValidatedOffset)
 	{
 		DesiredScrollOffset = InValidatedOffset;
@@ -880,9 +1683,9 @@ void SDynamicTableViewBase::EndInertialScrolling()
 	InertialScrollManager.ClearScrollVelocity();
 }
 
-void SDynamicTableViewBase::AddScrollOffset(const float InScrollOffsetDelta, bool RefreshList)
+void SDynamicTableViewBase::AddScrollOffset(const double InScrollOffsetDelta, bool RefreshList)
 {
-	if (FMath::IsNearlyEqual(InScrollOffsetDelta, 0.0f) == false)
+	if (FMath::IsNearlyEqual(InScrollOffsetDelta, 0.0) == false)
 	{
 		DesiredScrollOffset += InScrollOffsetDelta;
 		if (RefreshList)
@@ -945,30 +1748,38 @@ void SDynamicTableViewBase::SetWheelScrollMultiplier(float NewWheelScrollMultipl
 	WheelScrollMultiplier = NewWheelScrollMultiplier;
 }
 
+void SDynamicTableViewBase::SetStickToEnd(bool bInStickToEnd)
+{
+	if (bStickToEnd != bInStickToEnd)
+	{
+		bStickToEnd = bInStickToEnd;
+		RequestLayoutRefresh();
+	}
+}
+
 void SDynamicTableViewBase::SetBackgroundBrush(const TAttribute<const FSlateBrush*>& InBackgroundBrush)
 {
 	BackgroundBrush.SetImage(*this, InBackgroundBrush);
 }
 
-void SDynamicTableViewBase::InsertWidget( const TSharedRef<ITableRow> & WidgetToInset )
+void SDynamicTableViewBase::InsertWidget( const TSharedRef<ITableRow> & WidgetToInset, float Length )
 {
-	ItemsPanel->AddSlot(0)
-	[
-		WidgetToInset->AsWidget()
-	];
+	WidgetsToDisplay.Insert(WidgetToInset->AsWidget(), 0);
+	WidgetLengthsToDisplay.Insert(Length, 0);
 }
 
-void SDynamicTableViewBase::AppendWidget( const TSharedRef<ITableRow>& WidgetToAppend )
+void SDynamicTableViewBase::AppendWidget( const TSharedRef<ITableRow>& WidgetToAppend, float Length )
 {
-	ItemsPanel->AddSlot()
-	[
-		WidgetToAppend->AsWidget()
-	];
+	WidgetsToDisplay.Add(WidgetToAppend->AsWidget());
+	WidgetLengthsToDisplay.Add(Length);
 }
 
 void SDynamicTableViewBase::ClearWidgets()
 {
+	WidgetsToDisplay.Reset();
+	WidgetLengthsToDisplay.Reset();
 	ItemsPanel->ClearItems();
+	bItemsNeedRegeneration = true;
 }
 
 const FChildren* SDynamicTableViewBase::GetConstructedTableItems() const
@@ -1007,6 +1818,26 @@ int32 SDynamicTableViewBase::GetNumItemsPerLine() const
 	return 1;
 }
 
+double SDynamicTableViewBase::GetTotalItemsLength() const
+{
+	return CachedItemLengths.GetTotalLength();
+}
+
+TOptional<float> SDynamicTableViewBase::FindCachedItemLength(int32 ItemIndex, float LayoutScaleMultiplier) const
+{
+	return TOptional<float>();
+}
+
+void SDynamicTableViewBase::DiscardCachedItemLengths(int32 StartIndex, int32 NumItems)
+{
+}
+
+double SDynamicTableViewBase::GetMaxScrollOffset() const
+{
+	const FTableViewDimensions PanelDimensions(Orientation, PanelGeometryLastTick.GetLocalSize());
+	return FMath::Max(GetTotalItemsLength() - PanelDimensions.ScrollAxis, 0.0);
+}
+
 float SDynamicTableViewBase::GetFirstLineScrollOffset() const
 {
 	// FMath::Fractional() is insufficient here as it casts to int32 (too small for the integer part of a float when
@@ -1077,10 +1908,8 @@ void SDynamicTableViewBase::ScrollToTop()
 
 void SDynamicTableViewBase::ScrollToBottom()
 {
-	const float ScrollMax = GetTotalItemsLength() - GetCachedGeometry().GetLocalSize().Y;
-	
 	EndInertialScrolling();
-	SetScrollOffset(ScrollMax);
+	SetScrollOffset(GetMaxScrollOffset());
 	RequestLayoutRefresh();
 }
 
@@ -13,6 +13,7 @@
 #include "Framework/Layout/Overscroll.h"
 #include "Styling/SlateTypes.h"
 #include "Widgets/Views/STableViewBase.h"
+#include "DynamicListItemLengths.h"
 
 // #include "SDynamicTableViewBase.generated.h"
 
@@ -59,6 +60,73 @@ public:
 	 */
 	virtual void RequestListRefresh();
 
+	/**
+	 * Mark the lengths of a range of items as stale so that only those items are measured again on next tick.
+	 * Indices past the end of the currently measured items are appended, which makes this the cheap way to announce items added at the end of the list.
+	 */
+	void InvalidateItemLengthRange(int32 StartIndex, int32 NumItems);
+
+	/**
+	 * Forget the lengths remembered for a range of items, before they are removed from the items source for good.
+	 * Lengths are remembered by item so that they survive the item moving, the lengths of items that never expire are otherwise kept.
+	 */
+	void ForgetItemLengths(int32 StartIndex, int32 NumItems);
+
+	/**
+	 * Announce that items were inserted into the items source, once they are in it, instead of requesting a full refresh.
+	 * Only the new items are measured, and the content in view stays still when they were inserted above it.
+	 */
+	virtual void NotifyItemsInserted(int32 Index, int32 NumItems);
+
+	/** Announce that items were removed from the items source, once they are gone. The remaining items keep their lengths and the content in view stays still. */
+	virtual void NotifyItemsRemoved(int32 Index, int32 NumItems);
+
+	/**
+	 * Announce that consecutive items were moved within the items source, once they are moved. The moved items keep their lengths.
+	 *
+	 * @param FromIndex  Index the first moved item was at.
+	 * @param NumItems   Number of items moved.
+	 * @param ToIndex    Index the first moved item is at now.
+	 */
+	virtual void NotifyItemsMoved(int32 FromIndex, int32 NumItems, int32 ToIndex);
+
+	/** Announce that items of the items source were replaced by other items, once they are replaced. Only the new items are measured. */
+	virtual void NotifyItemsReplaced(int32 Index, int32 NumItems);
+
+	/**
+	 * Announce that the items source was re-ordered, filtered or extended as a whole, once it is.
+	 * PreviousIndices holds, for every item now in the source, its index in the previous items source or INDEX_NONE when it is new.
+	 * Items that were already there keep their lengths, and the item at the top of the view stays in place.
+	 */
+	virtual void NotifyItemsReordered(TArrayView<const int32> PreviousIndices);
+
+	/**
+	 * Start from an estimated length for every item and only measure items as they approach the visible area,
+	 * instead of measuring every item before the list can be displayed. Recommended for very large lists.
+	 *
+	 * @param bInUseEstimatedItemLengths  True to measure items lazily.
+	 * @param InEstimatedItemLength       Length assumed for the items that were not measured yet. When 0, the running average of the measured lengths is used.
+	 */
+	void SetUseEstimatedItemLengths(bool bInUseEstimatedItemLengths, float InEstimatedItemLength = 0.f);
+
+	/** @return The length assumed for the items that were not measured yet */
+	float GetEstimatedItemLength() const;
+
+	/**
+	 * Measure the items still holding an estimated length a few at a time, spending at most the given time per frame.
+	 * Items around the visible area are measured first, then measurement expands outwards, favouring the current scroll direction.
+	 * Every item starts from an estimated length while this is enabled, even if SetUseEstimatedItemLengths was not.
+	 *
+	 * @param InMillisecondsPerFrame  Time budget per frame for background measurement. 0 disables it.
+	 */
+	void SetItemMeasurementBudget(float InMillisecondsPerFrame);
+
+	/** @return True while background measurement still has items left to measure */
+	bool IsMeasuringItems() const;
+
+	/** @return The fraction of the items whose length was measured rather than estimated, between 0 and 1 */
+	float GetItemMeasurementProgress() const;
+
 	/** Completely wipe existing widgets and fully regenerate them on next tick. */
 	virtual void RebuildList() = 0;
 
@@ -77,17 +145,17 @@ public:
 	/** Returns whether the attached scrollbar is scrolling */
 	bool IsScrolling() const;
 
-	/** Gets the scroll offset of this view (in items) */
-	float GetScrollOffset() const;
+	/** Gets the scroll offset of this view, in Slate units from the start of the list */
+	double GetScrollOffset() const;
 
-	/** Set the scroll offset of this view (in items) */
-	void SetScrollOffset( const float InScrollOffset );
+	/** Set the scroll offset of this view, in Slate units from the start of the list */
+	void SetScrollOffset( const double InScrollOffset );
 
 	/** Reset the inertial scroll velocity accumulated in the InertialScrollManager */
 	void EndInertialScrolling();
 
-	/** Add the scroll offset of this view (in items) */
-	void AddScrollOffset(const float InScrollOffsetDelta, bool RefreshList = false);
+	/** Add to the scroll offset of this view, in Slate units */
+	void AddScrollOffset(const double InScrollOffsetDelta, bool RefreshList = false);
 
 	EVisibility GetScrollbarVisibility() const;
 
@@ -111,6 +179,13 @@ public:
 	/** Sets the multiplier applied when wheel scrolling. Higher numbers will cover more distance per click of the wheel. */
 	void SetWheelScrollMultiplier(float NewWheelScrollMultiplier);
 
+	/**
+	 * Sets whether the view sticks to the end of the list while it is there, e.g. for feeds items keep being appended to.
+	 * Scrolling away from the end lets go of it, the content in view then stays put as items are appended or removed before it.
+	 * Scrolling back to the end sticks to it again.
+	 */
+	void SetStickToEnd(bool bInStickToEnd);
+
 	/** Sets the Background Brush */
 	void SetBackgroundBrush(const TAttribute<const FSlateBrush*>& InBackgroundBrush);
 
@@ -162,7 +237,7 @@ protected:
 	 *
 	 * @return The amount actually scrolled in items
 	 */
-	virtual float ScrollBy( const FGeometry& MyGeometry, float ScrollByAmount, EAllowOverscroll InAllowOverscroll );
+	virtual double ScrollBy( const FGeometry& MyGeometry, double ScrollByAmount, EAllowOverscroll InAllowOverscroll );
 
 	/**
 	 * Scroll the view to an offset and resets the inertial scroll velocity 
@@ -171,13 +246,19 @@ protected:
 	 *
 	 * @return The amount actually scrolled
 	 */
-	virtual float ScrollTo( float InScrollOffset);
+	virtual double ScrollTo( double InScrollOffset);
 
-	/** Insert WidgetToInsert at the top of the view. */
-	void InsertWidget( const TSharedRef<ITableRow> & WidgetToInset );
+	/**
+	 * Insert WidgetToInsert at the top of the view. The view is updated once the items have been regenerated.
+	 * Length is the widget's length along the scroll axis as measured while generating it, zero if it is not visible.
+	 */
+	void InsertWidget( const TSharedRef<ITableRow> & WidgetToInset, float Length );
 
-	/** Add a WidgetToAppend to the bottom of the view. */
-	void AppendWidget( const TSharedRef<ITableRow>& WidgetToAppend );
+	/**
+	 * Add a WidgetToAppend to the bottom of the view. The view is updated once the items have been regenerated.
+	 * Length is the widget's length along the scroll axis as measured while generating it, zero if it is not visible.
+	 */
+	void AppendWidget( const TSharedRef<ITableRow>& WidgetToAppend, float Length );
 
 	const FChildren* GetConstructedTableItems() const;
 
@@ -264,11 +345,50 @@ protected:
 	virtual FReGenerateResults ReGenerateItems( const FGeometry& MyGeometry ) = 0;
 
 	/** @return The total length along all item widgets */
-	virtual double GetTotalItemsLength() const = 0;
+	virtual double GetTotalItemsLength() const;
+
+	/** @return The largest scroll offset that still fills the items panel, i.e. the total items length minus the visible length along the scroll axis */
+	double GetMaxScrollOffset() const;
 
 	/** populate and total items length */
 	virtual void ComputeTotalItemsLength(float LayoutScaleMultiplier) = 0;
 
+	/** Measure the given range of items again, appending any index that is not measured yet, and patch the total items length */
+	virtual void ComputeItemLengthRange(int32 StartIndex, int32 NumItems, float LayoutScaleMultiplier) = 0;
+
+	/**
+	 * Measure the estimated items that can share the view with the given item, whatever it is aligned with,
+	 * so that a scroll offset computed from its offset lands it exactly where it should be.
+	 */
+	void MeasureItemsAround(int32 ItemIndex, double ViewLength);
+
+	/** @return The length the item at the given index was already measured with in the current layout, if known without measuring it */
+	virtual TOptional<float> FindCachedItemLength(int32 ItemIndex, float LayoutScaleMultiplier) const;
+
+	/** Forget any length remembered for the given range of items, so that they really get measured again */
+	virtual void DiscardCachedItemLengths(int32 StartIndex, int32 NumItems);
+
+	/** @return The size of the items panel along the line axis that item lengths are being measured for */
+	float GetMeasuredLineAxisLength() const { return MeasuredLineAxisLength; }
+
+	/**
+	 * Remove all the cached item lengths, reserving room for the given number of items.
+	 * Their average is kept as the estimate until items are measured again, unless ForgetItemLengthEstimate was called.
+	 */
+	void ResetItemLengths(int32 NumItemsToReserve);
+
+	/** The items observed changed for others, e.g. a new items source: lengths measured so far say nothing about the new items */
+	void ForgetItemLengthEstimate();
+
+	/**
+	 * Store the measured length of an item, appending it if it is the item right after the last cached one.
+	 * Callers measuring items above the visible area wrap it in CaptureScrollAnchor and ApplyScrollAnchor so the content on screen does not move.
+	 */
+	void SetMeasuredItemLength(int32 ItemIndex, float InLength);
+
+	/** @return True if the last scroll went towards the beginning of the list */
+	bool IsScrollingBackward() const { return bLastScrolledBackward; }
+
 	/** @return how many items there are in the TArray being observed */
 	virtual int32 GetNumItemsBeingObserved() const = 0;
 
@@ -313,6 +433,12 @@ protected:
 	/** The panel which holds the pinned widgets in this list */
 	TSharedPtr< SDynamicListPanel > PinnedItemsPanel;
 
+	/** Widgets added while regenerating the items, in display order, handed to the items panel once done */
+	TArray< TSharedRef<SWidget> > WidgetsToDisplay;
+
+	/** Lengths along the scroll axis of WidgetsToDisplay, so the items panel does not have to measure them again */
+	TArray< float > WidgetLengthsToDisplay;
+
 	/** The scroll bar widget */
 	TSharedPtr< SScrollBar > ScrollBar;
 
@@ -332,11 +458,11 @@ protected:
 	/** True to allow right click drag scrolling. */
 	bool bEnableRightClickScrolling = true;
 
-	/** The currently displayed scroll offset from the beginning of the list in items. */
+	/** The currently displayed scroll offset from the beginning of the list in Slate units. */
 	double CurrentScrollOffset = 0.;
 
 	/** 
-	 * The raw desired scroll offset from the beginning of the list in items.
+	 * The raw desired scroll offset from the beginning of the list in Slate units.
 	 * Does not incorporate the FixedLineScrollOffset. Use GetTargetScrollOffset() to know the final target offset to display.
 	 * Note: If scroll animation is disabled and there is no FixedLineScrollOffset, this is identical to both the CurrentScrollOffset and the target offset.
 	 */
@@ -352,7 +478,7 @@ protected:
 	FVector2f PressedScreenSpacePosition;
 
 	/** The amount we have scrolled this tick cycle */
-	float TickScrollDelta;
+	double TickScrollDelta;
 
 	/** Information about the widgets we generated during the last regenerate pass */
 	FReGenerateResults LastGenerateResults;
@@ -360,6 +486,9 @@ protected:
 	/** Last time we scrolled, did we end up at the end of the list. */
 	bool bWasAtEndOfList;
 
+	/** True to keep the view at the end of the list while it is there */
+	bool bStickToEnd = false;
+
 	/** What the list's geometry was the last time a refresh occurred. */
 	FGeometry PanelGeometryLastTick;
 
@@ -393,6 +522,9 @@ protected:
 	/** Brush resource representing the background area of the view */
 	FInvalidatableBrushAttribute BackgroundBrush;
 
+	/** Length along the scroll axis of every observed item, indexed for O(log N) offset <-> item lookups */
+	FDynamicListItemLengths CachedItemLengths;
+
 protected:
 
 	/** Check whether the current state of the table warrants inertial scroll by the specified amount */
@@ -418,9 +550,119 @@ protected:
 	EConsumeMouseWheel ConsumeMouseWheel;
 
 private:
+	/** Bring CachedItemLengths up to date, re-measuring everything only when the list or the layout it was measured with changed */
+	void UpdateItemLengths(float LayoutScaleMultiplier, float LineAxisLength);
+
+	/** Append estimated lengths for the given number of items, to be measured once they approach the visible area, unless their length is already known */
+	void AddEstimatedItemLengths(int32 NumItems, float LayoutScaleMultiplier);
+
+	/** Measure the items of the given range that only have an estimated length. @return True if any got measured. */
+	bool MeasureEstimatedItems(int32 FirstIndex, int32 LastIndex);
+
+	/** Insert the lengths of items inserted into the items source, following the content in view when they land above it */
+	void InsertItemLengths(int32 Index, TArrayView<const float> InLengths, const TBitArray<>& InMeasured);
+
+	/** Remove the lengths of items removed from the items source, following the content in view */
+	void RemoveItemLengths(int32 Index, int32 NumItems);
+
+	/** Replace the estimated lengths of the items around the visible area with measured ones */
+	void MeasureItemsNearView(double ViewLength, float LayoutScaleMultiplier);
+
+	/**
+	 * Measure estimated items outwards from the visible area until this frame's measurement budget runs out.
+	 * @return True if measurement progressed and there are still items left to measure next frame.
+	 */
+	bool MeasureItemsInBackground(double ViewLength, float LayoutScaleMultiplier);
+
+	/** @return True if item lengths start as estimates and get measured as needed */
+	virtual bool ShouldEstimateItemLengths() const;
+
+	/** The items overlapping the visible area and where they lie, as of a given scroll offset and item lengths */
+	struct FVisibleItemRange
+	{
+		int32 NumItems = 0;
+		int32 FirstIndex = INDEX_NONE;
+		int32 LastIndex = INDEX_NONE;
+
+		/** Sum of the lengths of the visible items. Where they start does not matter, rows are placed relative to the first one. */
+		double Length = 0.;
+
+		bool operator==(const FVisibleItemRange& Other) const
+		{
+			return NumItems == Other.NumItems && FirstIndex == Other.FirstIndex && LastIndex == Other.LastIndex && Length == Other.Length;
+		}
+	};
+
+	/** @return The items overlapping the visible area at the current scroll offset */
+	FVisibleItemRange GetVisibleItemRange(double ViewLength) const;
+
+	/** Update the scroll bar thumb from the current scroll offset */
+	void UpdateScrollBar(double ViewLength);
+
+	/** Remember which item the view starts on and where that item starts, before item lengths change */
+	void CaptureScrollAnchor();
+
+	/**
+	 * Move the scroll offsets by however much the anchor item moved since it was captured,
+	 * so that items before it changing length do not move the content in view.
+	 */
+	void ApplyScrollAnchor();
+
+	/** The item the view started on when the scroll anchor was captured, INDEX_NONE if there was none */
+	int32 ScrollAnchorIndex = INDEX_NONE;
+
+	/** The offset the anchor item started at when the scroll anchor was captured */
+	double ScrollAnchorItemOffset = 0.;
+
 	/** When true, a refresh should occur the next tick */
 	bool bItemsNeedRefresh = false;
 
+	/** When true, the next refresh has to regenerate the items even if the visible ones did not change */
+	bool bItemsNeedRegeneration = true;
+
+	/** The visible items the last regeneration generated widgets for, while they stay the same a scroll only moves the widgets */
+	FVisibleItemRange LastGeneratedItemRange;
+
 	/** When true, a populate total items length should occur the next tick */
 	bool bTotalItemLengthNeedRefresh = false;
+
+	/** Ranges of items that must be measured again on the next tick */
+	TArray<FInt32Interval> DirtyItemLengthRanges;
+
+	/** The layout scale the cached item lengths were measured with */
+	float MeasuredLayoutScaleMultiplier = 0.f;
+
+	/** The size of the items panel along the line axis when the cached item lengths were measured */
+	float MeasuredLineAxisLength = 0.f;
+
+	/** True to start from estimated item lengths and measure items lazily */
+	bool bUseEstimatedItemLengths = false;
+
+	/** User supplied length for the items not measured yet, or 0 to use the running average */
+	float EstimatedItemLength = 0.f;
+
+	/** Which of the cached item lengths were actually measured, as opposed to estimated */
+	TBitArray<> MeasuredItemLengths;
+
+	/** Sum of the lengths of the items currently measured, over NumMeasuredItems for the running average estimate */
+	double MeasuredItemLengthSum = 0.;
+
+	/** Average length of the items measured before the lengths were last reset, the estimate until items are measured again. 0 when unknown. */
+	float PreviousItemLengthAverage = 0.f;
+
+	/** True to start the estimate over at the next reset of the lengths */
+	bool bForgetItemLengthEstimate = false;
+
+	/** Number of set bits in MeasuredItemLengths */
+	int32 NumMeasuredItems = 0;
+
+	/** Milliseconds per frame that may be spent measuring estimated items in the background, 0 when disabled */
+	float ItemMeasurementBudgetMs = 0.f;
+
+	/** Background measurement resumes from these indices: the next item to look at after and before the area measured so far */
+	int32 NextItemToMeasureForward = 0;
+	int32 NextItemToMeasureBackward = INDEX_NONE;
+
+	/** True if the last scroll went towards the beginning of the list, which background measurement then favours */
+	bool bLastScrolledBackward = false;
 };
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "DynamicListItemHandle.h"
+#include "IUserIndexDynamicListEntry.h"
 #include "IUserObjectDynamicListEntry.h"
 #include "SDynamicListView.h"
 #include "Slate/SObjectWidget.h"
@@ -530,3 +532,15 @@ inline void SObjectDynamicTableRow<UObject*>::InitObjectRowInternal(UUserWidget&
 		IUserObjectDynamicListEntry::SetListItemObject(*WidgetObject, ListItemObject);
 	}
 }
+
+template <>
+inline void SObjectDynamicTableRow<FDynamicListItemHandle>::InitObjectRowInternal(UUserWidget& ListEntryWidget, FDynamicListItemHandle ListItemHandle)
+{
+	if (ListEntryWidget.Implements<UUserIndexDynamicListEntry>())
+	{
+		// Handles carry no data, the entry looks it up by the index of its row
+		const TSharedPtr<ITypedTableView<FDynamicListItemHandle>> OwnerTable = OwnerTablePtr.Pin();
+		const int32 ListItemIndex = OwnerTable.IsValid() ? StaticCastSharedPtr<SDynamicListView<FDynamicListItemHandle>>(OwnerTable)->GetIndexOfItem(ListItemHandle) : INDEX_NONE;
+		IUserIndexDynamicListEntry::SetListItemIndex(*WidgetObject, ListItemIndex);
+	}
+}